@@ -33,6 +33,7 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/common/OpmLog/TimerLog.cpp
       src/opm/common/utility/ActiveGridCells.cpp
       src/opm/common/utility/FileSystem.cpp
+      src/opm/common/utility/MappedFile.cpp
       src/opm/common/utility/numeric/MonotCubicInterpolator.cpp
       src/opm/common/utility/OpmInputError.cpp
       src/opm/common/utility/parameters/Parameter.cpp
@@ -72,6 +73,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/EclipseState/checkDeck.cpp
     src/opm/input/eclipse/EclipseState/EclipseConfig.cpp
     src/opm/input/eclipse/EclipseState/EclipseState.cpp
+    src/opm/input/eclipse/EclipseState/StateSnapshot.cpp
     src/opm/input/eclipse/EclipseState/EndpointScaling.cpp
     src/opm/input/eclipse/EclipseState/Grid/FieldProps.cpp
     src/opm/input/eclipse/EclipseState/Grid/FieldPropsManager.cpp
@@ -106,6 +108,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/Action/Actions.cpp
     src/opm/input/eclipse/Schedule/Action/ActionX.cpp
     src/opm/input/eclipse/Schedule/Action/ActionParser.cpp
+    src/opm/input/eclipse/Schedule/Action/ActionProgram.cpp
     src/opm/input/eclipse/Schedule/Action/ActionValue.cpp
     src/opm/input/eclipse/Schedule/Action/ASTNode.cpp
     src/opm/input/eclipse/Schedule/Action/Condition.cpp
@@ -203,6 +206,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/UDQ/UDQASTNode.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    src/opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQActive.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQAssign.cpp
@@ -217,6 +221,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/UDQ/UDQState.cpp
     src/opm/input/eclipse/Schedule/VFPInjTable.cpp
     src/opm/input/eclipse/Schedule/VFPProdTable.cpp
+    src/opm/input/eclipse/Parser/DeckCache.cpp
     src/opm/input/eclipse/Parser/ErrorGuard.cpp
     src/opm/input/eclipse/Parser/ParseContext.cpp
     src/opm/input/eclipse/Parser/Parser.cpp
@@ -230,6 +235,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Units/Dimension.cpp
     src/opm/input/eclipse/Units/UnitSystem.cpp
     src/opm/input/eclipse/Utility/Functional.cpp
+    src/opm/input/eclipse/Utility/InputProfiler.cpp
   )
 
 
@@ -280,6 +286,7 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          src/opm/io/eclipse/ByteSwap.cpp
           src/opm/io/eclipse/EclFile.cpp
           src/opm/io/eclipse/EclOutput.cpp
           src/opm/io/eclipse/EclUtil.cpp
@@ -294,6 +301,7 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/io/eclipse/OutputStream.cpp
           src/opm/io/eclipse/ExtSmryOutput.cpp
           src/opm/io/eclipse/RestartFileView.cpp
+          src/opm/io/eclipse/SummaryHistory.cpp
           src/opm/io/eclipse/SummaryNode.cpp
           src/opm/io/eclipse/rst/action.cpp
           src/opm/io/eclipse/rst/aquifer.cpp
@@ -371,6 +379,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_ESmry.cpp
     tests/test_EInit.cpp
     tests/test_ExtESmry.cpp
+    tests/test_SummaryHistory.cpp
     tests/parser/ACTIONX.cpp
     tests/parser/ADDREGTests.cpp
     tests/parser/AquiferTests.cpp
@@ -422,6 +431,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/SimpleTableTests.cpp
     tests/parser/SimulationConfigTest.cpp
     tests/parser/StarTokenTests.cpp
+    tests/parser/StateSnapshotTests.cpp
     tests/parser/StringTests.cpp
     tests/parser/SummaryConfigTests.cpp
     tests/parser/TabdimsTests.cpp
@@ -585,6 +595,8 @@ if(ENABLE_ECL_INPUT)
     tests/BASE.UNRST
   )
   list (APPEND EXAMPLE_SOURCE_FILES
+    examples/byteswap_bench.cpp
+    examples/udq_bench.cpp
     examples/opmi.cpp
     examples/opmpack.cpp
     examples/opmhash.cpp
@@ -623,9 +635,11 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/OpmLog/OpmLog.hpp
       opm/common/OpmLog/StreamLog.hpp
       opm/common/OpmLog/TimerLog.hpp
+      opm/common/utility/BinarySerializer.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/ActiveGridCells.hpp
       opm/common/utility/FileSystem.hpp
+      opm/common/utility/MappedFile.hpp
       opm/common/utility/OpmInputError.hpp
       opm/common/utility/numeric/cmp.hpp
       opm/common/utility/platform_dependent/disable_warnings.h
@@ -655,12 +669,14 @@ if(ENABLE_ECL_INPUT)
        opm/io/eclipse/SummaryNode.hpp
        opm/json/JsonObject.hpp
        opm/input/eclipse/Utility/Functional.hpp
+       opm/input/eclipse/Utility/InputProfiler.hpp
        opm/input/eclipse/Utility/Typetools.hpp
        opm/input/eclipse/Generator/KeywordGenerator.hpp
        opm/input/eclipse/Generator/KeywordLoader.hpp
        opm/input/eclipse/Units/UnitSystem.hpp
        opm/input/eclipse/Units/Units.hpp
        opm/input/eclipse/Units/Dimension.hpp
+       opm/input/eclipse/Parser/DeckCache.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
        opm/input/eclipse/Parser/Parser.hpp
@@ -781,6 +797,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/EclipseState/Tables/SgofTable.hpp
        opm/input/eclipse/EclipseState/Tables/TracerVdTable.hpp
        opm/input/eclipse/EclipseState/EclipseState.hpp
+       opm/input/eclipse/EclipseState/StateSnapshot.hpp
        opm/input/eclipse/EclipseState/EclipseConfig.hpp
        opm/input/eclipse/EclipseState/Aquifer/Aquancon.hpp
        opm/input/eclipse/EclipseState/Aquifer/AquiferConfig.hpp
@@ -792,6 +809,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquifers.hpp
        opm/input/eclipse/Schedule/Action/ActionAST.hpp
        opm/input/eclipse/Schedule/Action/ActionContext.hpp
+       opm/input/eclipse/Schedule/Action/ActionProgram.hpp
        opm/input/eclipse/Schedule/Action/ActionResult.hpp
        opm/input/eclipse/Schedule/Action/ActionValue.hpp
        opm/input/eclipse/Schedule/Action/Actdims.hpp
@@ -879,6 +897,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
        opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
        opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
        opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
        opm/input/eclipse/Schedule/UDQ/UDQActive.hpp
        opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
@@ -902,6 +921,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/ByteSwap.hpp
+        opm/io/eclipse/EclArrayView.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -917,6 +938,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/OutputStream.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
         opm/io/eclipse/RestartFileView.hpp
+        opm/io/eclipse/SummaryHistory.hpp
         opm/io/eclipse/SummaryNode.hpp
         opm/io/eclipse/rst/action.hpp
         opm/io/eclipse/rst/aquifer.hpp
@@ -0,0 +1,117 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include <opm/io/eclipse/ByteSwap.hpp>
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+
+static void printHelp() {
+
+    std::cout << "\nThis program measures the throughput (GB/s) of the byte swap kernels used when reading and\n"
+              << "writing binary ECLIPSE files. Arrays are converted one Fortran record (1000 elements) at the time.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-n Number of elements in each array, default 10000000.\n"
+              << "-r Number of repetitions, default 20.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+
+template <typename T>
+double throughput(std::vector<T>& data, int repetitions, Opm::EclIO::ByteSwapKernel kernel)
+{
+    const std::size_t record = Opm::EclIO::MaxBlockSizeInte / Opm::EclIO::sizeOfInte;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int r = 0; r < repetitions; r++) {
+        for (std::size_t offset = 0; offset < data.size(); offset += record) {
+            const auto num = std::min(record, data.size() - offset);
+
+            if constexpr (sizeof(T) == 4)
+                Opm::EclIO::byteSwap32(data.data() + offset, data.data() + offset, num, kernel);
+            else
+                Opm::EclIO::byteSwap64(data.data() + offset, data.data() + offset, num, kernel);
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double bytes = static_cast<double>(data.size()) * sizeof(T) * repetitions;
+    return bytes / elapsed.count() * 1.0e-9;
+}
+
+
+int main(int argc, char **argv) {
+
+    int c = 0;
+    std::size_t size = 10000000;
+    int repetitions = 20;
+
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            size = std::stoul(optarg);
+            break;
+        case 'r':
+            repetitions = std::stoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<int> inte(size);
+    std::vector<float> real(size);
+    std::vector<double> doub(size);
+
+    std::iota(inte.begin(), inte.end(), 0);
+    std::iota(real.begin(), real.end(), 0.0f);
+    std::iota(doub.begin(), doub.end(), 0.0);
+
+    std::cout << "\nactive kernel: " << Opm::EclIO::byteSwapKernelName(Opm::EclIO::activeByteSwapKernel()) << "\n\n";
+    std::cout << std::left << std::setw(10) << "kernel"
+              << std::right << std::setw(12) << "INTE GB/s"
+              << std::setw(12) << "REAL GB/s"
+              << std::setw(12) << "DOUB GB/s" << "\n";
+
+    for (const auto& kernel : Opm::EclIO::availableByteSwapKernels()) {
+        std::cout << std::left << std::setw(10) << Opm::EclIO::byteSwapKernelName(kernel)
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << throughput(inte, repetitions, kernel)
+                  << std::setw(12) << throughput(real, repetitions, kernel)
+                  << std::setw(12) << throughput(doub, repetitions, kernel) << "\n";
+    }
+
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <getopt.h>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/TimeService.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
+
+
+static void printHelp() {
+
+    std::cout << "\nThis program compares the time used to evaluate the UDQ DEFINE expressions of a deck by walking\n"
+              << "the syntax tree and by running the compiled UDQ program. The summary variables used by the\n"
+              << "expressions are set to random values for all wells and groups in the schedule.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-s Report step, default is the last report step.\n"
+              << "-r Number of repetitions, default 10000.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+
+template <typename Eval>
+double elapsed_time(const Eval& eval, int repetitions)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++)
+        eval();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+
+int main(int argc, char **argv) {
+
+    int c = 0;
+    int repetitions = 10000;
+    int report_step = -1;
+
+    while ((c = getopt(argc, argv, "s:r:h")) != -1) {
+        switch (c) {
+        case 's':
+            report_step = std::stoi(optarg);
+            break;
+        case 'r':
+            repetitions = std::stoi(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    Opm::Parser parser;
+    Opm::ParseContext parse_context;
+    Opm::ErrorGuard error_guard;
+    auto python = std::make_shared<Opm::Python>();
+
+    Opm::OpmLog::setupSimpleDefaultLogging();
+    Opm::Deck deck = parser.parseFile(argv[optind], parse_context, error_guard);
+    Opm::EclipseState state(deck);
+    Opm::Schedule schedule(deck, state, parse_context, error_guard, python);
+    error_guard.clear();
+
+    const std::size_t step = report_step < 0 ? schedule.size() - 1 : report_step;
+    const auto& udq = schedule.getUDQConfig(step);
+    const auto wells = schedule.wellNames(step);
+    const auto groups = schedule.groupNames(step);
+
+    std::unordered_set<std::string> summary_keys;
+    udq.required_summary(summary_keys);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> value(0, 1000);
+    Opm::SummaryState st(Opm::TimeService::now());
+    for (const auto& key : summary_keys) {
+        switch (Opm::UDQ::targetType(key)) {
+        case Opm::UDQVarType::WELL_VAR:
+            for (const auto& well : wells)
+                st.update_well_var(well, key, value(gen));
+            break;
+        case Opm::UDQVarType::GROUP_VAR:
+            for (const auto& group : groups)
+                st.update_group_var(group, key, value(gen));
+            break;
+        default:
+            st.update(key, value(gen));
+        }
+    }
+
+    // Evaluate all the UDQs once, so the UDQ variables used by other
+    // expressions are defined.
+    Opm::UDQState udq_state(udq.params().undefinedValue());
+    const auto wm = schedule.wellMatcher(step);
+    udq.eval(step, wm, st, udq_state);
+    Opm::UDQContext context(udq.function_table(), wm, st, udq_state);
+
+    std::cout << "\nreport step: " << step << "  wells: " << wells.size() << "  groups: " << groups.size() << "\n\n";
+    std::cout << std::left << std::setw(12) << "UDQ"
+              << std::right << std::setw(14) << "tree us/eval"
+              << std::setw(16) << "program us/eval"
+              << std::setw(10) << "speedup" << "\n";
+
+    double total_tree = 0;
+    double total_program = 0;
+    for (const auto& def : udq.definitions()) {
+        double tree = 0;
+        double program = 0;
+        try {
+            tree = elapsed_time([&def, &context]() { def.eval_tree(context); }, repetitions);
+            program = elapsed_time([&def, &context]() { def.eval(context); }, repetitions);
+        } catch (const std::exception& e) {
+            std::cout << std::left << std::setw(12) << def.keyword() << " skipped: " << e.what() << "\n";
+            continue;
+        }
+
+        total_tree += tree;
+        total_program += program;
+        std::cout << std::left << std::setw(12) << def.keyword()
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << tree / repetitions * 1.0e6
+                  << std::setw(16) << program / repetitions * 1.0e6
+                  << std::setw(10) << std::setprecision(2) << tree / program << "\n";
+    }
+
+    if (total_program > 0)
+        std::cout << std::left << std::setw(12) << "total"
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << total_tree / repetitions * 1.0e6
+                  << std::setw(16) << total_program / repetitions * 1.0e6
+                  << std::setw(10) << std::setprecision(2) << total_tree / total_program << "\n";
+
+    std::cout << std::endl;
+
+    return 0;
+}
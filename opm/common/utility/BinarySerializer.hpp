@@ -0,0 +1,308 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BINARY_SERIALIZER_HPP
+#define OPM_BINARY_SERIALIZER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The BinarySerializer class implements the serializer protocol used by the
+  templated serializeOp() methods throughout opm-common, i.e. operator(),
+  vector(), map() and isSerializing(). Objects are packed into a flat byte
+  buffer, and unpacked again from a memory area - typically a memory mapped
+  file.
+
+  Plain values are stored in native byte order, so the buffers are not
+  portable between machines with different endianness; they are intended
+  for caching and not for archival. Unpacking is bounds checked and throws
+  std::runtime_error if the memory area is truncated or corrupt.
+*/
+
+class BinarySerializer {
+public:
+    // Pack into buffer; the packed objects are appended to the buffer.
+    explicit BinarySerializer(std::vector<char>& buffer)
+        : m_buffer(&buffer)
+    {}
+
+    // Unpack from the memory area [data, data + size).
+    BinarySerializer(const char* data, std::size_t size)
+        : m_pos(data)
+        , m_end(data + size)
+    {}
+
+    bool isSerializing() const {
+        return this->m_buffer != nullptr;
+    }
+
+    // The number of bytes which have not yet been unpacked.
+    std::size_t remaining() const {
+        return static_cast<std::size_t>(this->m_end - this->m_pos);
+    }
+
+    template<class T>
+    void operator()(const T& data) {
+        this->process(const_cast<T&>(data));
+    }
+
+    template<class T, bool complexType = true>
+    void vector(std::vector<T>& data) {
+        this->process(data);
+    }
+
+    template<class Array, bool complexType = true>
+    void array(Array& data) {
+        this->process(data);
+    }
+
+    template<class Map, bool complexType = true>
+    void map(Map& data) {
+        this->process(data);
+    }
+
+    template<class T>
+    static std::vector<char> pack(const T& data) {
+        std::vector<char> buffer;
+        BinarySerializer serializer(buffer);
+        serializer(data);
+        return buffer;
+    }
+
+    template<class T>
+    static void unpack(const std::vector<char>& buffer, T& data) {
+        BinarySerializer serializer(buffer.data(), buffer.size());
+        serializer(data);
+    }
+
+private:
+    template<class T> struct is_vector : std::false_type {};
+    template<class T, class A> struct is_vector<std::vector<T, A>> : std::true_type {};
+
+    template<class T> struct is_array : std::false_type {};
+    template<class T, std::size_t N> struct is_array<std::array<T, N>> : std::true_type {};
+
+    template<class T> struct is_optional : std::false_type {};
+    template<class T> struct is_optional<std::optional<T>> : std::true_type {};
+
+    template<class T> struct is_pair : std::false_type {};
+    template<class T1, class T2> struct is_pair<std::pair<T1, T2>> : std::true_type {};
+
+    template<class T> struct is_tuple : std::false_type {};
+    template<class... Ts> struct is_tuple<std::tuple<Ts...>> : std::true_type {};
+
+    template<class T> struct is_variant : std::false_type {};
+    template<class... Ts> struct is_variant<std::variant<Ts...>> : std::true_type {};
+
+    template<class T> struct is_pointer : std::false_type {};
+    template<class T> struct is_pointer<std::shared_ptr<T>> : std::true_type {};
+    template<class T, class D> struct is_pointer<std::unique_ptr<T, D>> : std::true_type {};
+
+    template<class T> struct is_map : std::false_type {};
+    template<class K, class T, class C, class A> struct is_map<std::map<K, T, C, A>> : std::true_type {};
+    template<class K, class T, class H, class E, class A> struct is_map<std::unordered_map<K, T, H, E, A>> : std::true_type {};
+
+    template<class T> struct is_set : std::false_type {};
+    template<class K, class C, class A> struct is_set<std::set<K, C, A>> : std::true_type {};
+    template<class K, class H, class E, class A> struct is_set<std::unordered_set<K, H, E, A>> : std::true_type {};
+
+    template<class T, class = void>
+    struct has_serializeOp : std::false_type {};
+
+    template<class T>
+    struct has_serializeOp<T, std::void_t<decltype(std::declval<T&>().serializeOp(std::declval<BinarySerializer&>()))>> : std::true_type {};
+
+    template<class T>
+    static constexpr bool is_plain = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+    std::vector<char>* m_buffer = nullptr;
+    const char* m_pos = nullptr;
+    const char* m_end = nullptr;
+
+    void bytes(void* data, std::size_t size) {
+        if (size == 0)
+            return;
+
+        if (this->isSerializing()) {
+            const auto* first = static_cast<const char*>(data);
+            this->m_buffer->insert(this->m_buffer->end(), first, first + size);
+            return;
+        }
+
+        if (this->remaining() < size)
+            throw std::runtime_error("BinarySerializer: unexpected end of data");
+
+        std::memcpy(data, this->m_pos, size);
+        this->m_pos += size;
+    }
+
+    // Every element occupies at least one byte, so a length exceeding the
+    // remaining number of bytes implies corrupt data.
+    std::size_t length(std::size_t size) {
+        this->bytes(&size, sizeof size);
+        if (!this->isSerializing() && size > this->remaining())
+            throw std::runtime_error("BinarySerializer: corrupt data");
+
+        return size;
+    }
+
+    template<class Variant, std::size_t Index = 0>
+    void emplace_variant(Variant& data, std::size_t index) {
+        if constexpr (Index < std::variant_size_v<Variant>) {
+            if (index == Index) {
+                data.template emplace<Index>();
+                return;
+            }
+            this->emplace_variant<Variant, Index + 1>(data, index);
+        } else
+            throw std::runtime_error("BinarySerializer: invalid variant index");
+    }
+
+    template<class T>
+    void process(T& data) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            data.resize(this->length(data.size()));
+            this->bytes(data.data(), data.size());
+        }
+        else if constexpr (has_serializeOp<T>::value)
+            data.serializeOp(*this);
+        else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+            data.resize(this->length(data.size()));
+            for (std::size_t index = 0; index < data.size(); index++) {
+                bool value = data[index];
+                this->bytes(&value, sizeof value);
+                data[index] = value;
+            }
+        }
+        else if constexpr (is_vector<T>::value) {
+            using Value = typename T::value_type;
+            data.resize(this->length(data.size()));
+            if constexpr (is_plain<Value>)
+                this->bytes(data.data(), data.size() * sizeof(Value));
+            else {
+                for (auto& element : data)
+                    this->process(element);
+            }
+        }
+        else if constexpr (is_array<T>::value) {
+            for (auto& element : data)
+                this->process(element);
+        }
+        else if constexpr (is_optional<T>::value) {
+            bool has_value = data.has_value();
+            this->bytes(&has_value, sizeof has_value);
+            if (!has_value) {
+                data.reset();
+                return;
+            }
+
+            if (!this->isSerializing())
+                data.emplace();
+
+            this->process(*data);
+        }
+        else if constexpr (is_pointer<T>::value) {
+            bool has_value = static_cast<bool>(data);
+            this->bytes(&has_value, sizeof has_value);
+            if (!has_value) {
+                data.reset();
+                return;
+            }
+
+            using Value = typename T::element_type;
+            if (!this->isSerializing())
+                data.reset(new Value());
+
+            this->process(*data);
+        }
+        else if constexpr (is_pair<T>::value) {
+            this->process(const_cast<std::remove_const_t<typename T::first_type>&>(data.first));
+            this->process(data.second);
+        }
+        else if constexpr (is_tuple<T>::value)
+            std::apply([this](auto&... elements) { (this->process(elements), ...); }, data);
+        else if constexpr (is_variant<T>::value) {
+            std::size_t index = data.index();
+            this->bytes(&index, sizeof index);
+            if (!this->isSerializing())
+                this->emplace_variant(data, index);
+
+            std::visit([this](auto& value) { this->process(value); }, data);
+        }
+        else if constexpr (is_map<T>::value) {
+            const auto size = this->length(data.size());
+            if (this->isSerializing()) {
+                for (auto& [key, value] : data) {
+                    this->process(const_cast<typename T::key_type&>(key));
+                    this->process(value);
+                }
+                return;
+            }
+
+            data.clear();
+            for (std::size_t index = 0; index < size; index++) {
+                typename T::key_type key = typename T::key_type();
+                typename T::mapped_type value = typename T::mapped_type();
+                this->process(key);
+                this->process(value);
+                data.emplace(std::move(key), std::move(value));
+            }
+        }
+        else if constexpr (is_set<T>::value) {
+            const auto size = this->length(data.size());
+            if (this->isSerializing()) {
+                for (const auto& key : data)
+                    this->process(const_cast<typename T::key_type&>(key));
+                return;
+            }
+
+            data.clear();
+            for (std::size_t index = 0; index < size; index++) {
+                typename T::key_type key = typename T::key_type();
+                this->process(key);
+                data.insert(std::move(key));
+            }
+        }
+        else {
+            static_assert(std::is_trivially_copyable_v<T>, "BinarySerializer: unsupported type");
+            this->bytes(&data, sizeof data);
+        }
+    }
+};
+
+}
+
+#endif
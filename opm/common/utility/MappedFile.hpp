@@ -0,0 +1,70 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_MAPPEDFILE_HPP
+#define OPM_UTILITY_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The MappedFile class is a read-only memory map of an entire file. On POSIX
+  systems the file is mapped with mmap(MAP_SHARED), so several processes
+  reading the same file will share the pages in the operating system page
+  cache. On other platforms the file content is read into a private buffer,
+  i.e. the interface is the same but there is no sharing.
+
+  The mapping is released when the object is destroyed; pointers obtained
+  from data() must not outlive the MappedFile object.
+*/
+
+class MappedFile {
+public:
+    enum class Access {
+        Sequential,
+        Random
+    };
+
+    explicit MappedFile(const std::string& filename, Access access = Access::Random);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return this->m_data; }
+    std::size_t size() const { return this->m_size; }
+    const std::string& filename() const { return this->m_filename; }
+
+    // Hint to the operating system that the byte range [offset, offset +
+    // length) will be needed soon.
+    void prefetch(std::size_t offset, std::size_t length) const;
+
+private:
+    std::string m_filename;
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::vector<char> m_buffer;
+};
+
+}
+
+#endif
@@ -20,18 +20,64 @@
 #ifndef OPM_UTILITY_SHMATCH_HPP
 #define OPM_UTILITY_SHMATCH_HPP
 
+#include <bitset>
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Opm {
 
 /*
-  The shmatch() function is an implementation of the shell matching algorithm
-  used in posix function fnmatch(). It is implemented here based on std::regex
-  to avoid using a posix function.
+  The ShellPattern class is a compiled shell pattern with the matching rules
+  of the posix function fnmatch():
+
+    '*'     matches any sequence of characters, including the empty sequence.
+    '?'     matches any single character.
+    [...]   matches one character from the set, which can contain ranges like
+            [0-9]; the set is negated when it starts with '!' or '^'.
+    '\'     matches the following character literally.
+
+  All other characters only match themselves. The pattern is compiled once
+  to a list of segments separated by '*'; every segment is matched at the
+  leftmost position where it fits, so match() never backtracks over a '*'.
 */
 
-bool shmatch(const std::string& pattern, const std::string& symbol);
+class ShellPattern {
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(std::string_view symbol) const;
+
+    // True if the pattern has no special characters, i.e. it only matches
+    // the pattern string itself.
+    bool literal() const;
+
+private:
+    struct Element {
+        enum class Kind { Char, Any, Class };
+        Kind kind;
+        std::size_t value;
+    };
+    using Segment = std::vector<Element>;
 
+    bool match_at(const Segment& segment, std::string_view symbol, std::size_t offset) const;
+
+    std::string m_literal;
+    bool m_is_literal = true;
+    std::vector<Segment> m_segments;
+    std::vector<std::bitset<256>> m_classes;
+};
+
+/*
+  The shmatch() function matches symbol against the shell pattern; when the
+  same pattern is matched against many names it is better to create one
+  ShellPattern, or use match_all() which returns the indices of the names
+  matching the pattern.
+*/
+
+bool shmatch(const std::string& pattern, const std::string& symbol);
+std::vector<std::size_t> match_all(const std::string& pattern, const std::vector<std::string>& names);
 
 }
-#endif //OPM_UTILITY_STRING_HPP
+#endif //OPM_UTILITY_SHMATCH_HPP
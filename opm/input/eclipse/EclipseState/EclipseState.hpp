@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferConfig.hpp>
@@ -132,6 +133,37 @@ namespace Opm {
             m_micppara.serializeOp(serializer);
         }
 
+        // As serializeOp(), but also including the input grid and the field
+        // properties; used to store a complete snapshot of the state. The
+        // FieldPropsManager refers to the input grid, the EclipseState must
+        // therefore not be moved or copied after it has been unpacked.
+        template<class Serializer>
+        void serializeFull(Serializer& serializer)
+        {
+            this->serializeOp(serializer);
+            m_inputGrid.serializeOp(serializer);
+
+            std::vector<char> field_props_buffer;
+            if (serializer.isSerializing())
+                field_props_buffer = field_props.serialize();
+
+            serializer(field_props_buffer);
+            if (!serializer.isSerializing())
+                field_props.deserialize(field_props_buffer, m_inputGrid);
+        }
+
+        // Packs the same data as serializeFull() from a const EclipseState.
+        template<class Serializer>
+        void serializeFull(Serializer& serializer) const
+        {
+            if (!serializer.isSerializing())
+                throw std::logic_error("EclipseState::serializeFull(): cannot unpack into a const EclipseState");
+
+            serializer(*this);
+            serializer(m_inputGrid);
+            serializer(field_props.serialize());
+        }
+
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
 
@@ -181,6 +181,38 @@ namespace Opm {
         double getCellDepth(size_t globalIndex) const;
         ZcornMapper zcornMapper() const;
 
+        /*
+          By default the cell center, depth, dimensions, thickness and
+          volume are calculated from COORD and ZCORN on every call. With a
+          geometry cache enabled these quantities are calculated for all
+          cells the first time one of them is needed, and then served from
+          the cache until it is released or the grid geometry changes. The
+          Float cache uses half the memory of the Double cache, at the cost
+          of returning values rounded to single precision.
+
+          The cache is only a performance device, so it can be configured
+          and released through a const grid. Observe that the cache is built
+          lazily by the first const geometry getter which needs it; with a
+          cache enabled but not yet built the getters must therefore not be
+          called concurrently. The buildGeometryCache() method builds an
+          enabled cache up front, and does nothing if the cache is off.
+
+          The cache is off unless the owner of the grid enables it. It pays
+          off for callers which query the geometry of most cells repeatedly;
+          code which only visits a few cells, like the connection setup of
+          the Schedule, is faster without it.
+        */
+        enum class GeometryCache {
+            None,
+            Double,
+            Float
+        };
+
+        void setGeometryCache(GeometryCache mode) const;
+        GeometryCache geometryCache() const;
+        void releaseGeometryCache() const;
+        void buildGeometryCache() const;
+
         const std::vector<double>& getCOORD() const;
         const std::vector<double>& getZCORN() const;
         const std::vector<int>& getACTNUM( ) const;
@@ -202,6 +234,35 @@ namespace Opm {
 
         bool equal(const EclipseGrid& other) const;
 
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            GridDims::serializeOp(serializer);
+            serializer(m_minpvVector);
+            serializer(m_minpvMode);
+            serializer(m_pinch);
+            serializer(m_pinchoutMode);
+            serializer(m_multzMode);
+            serializer(m_pinchGapMode);
+            serializer(m_circle);
+            serializer(zcorn_fixed);
+            serializer(m_useActnumFromGdfile);
+            serializer(m_zcorn);
+            serializer(m_coord);
+            serializer(m_actnum);
+            serializer(m_mapaxes);
+            serializer(m_nactive);
+            serializer(m_active_to_global);
+            serializer(m_global_to_active);
+            serializer(m_aquifer_cells);
+            serializer(m_thetav);
+            serializer(m_rv);
+            if (!serializer.isSerializing()) {
+                active_volume.reset();
+                releaseGeometryCache();
+            }
+        }
+
     private:
         std::vector<double> m_minpvVector;
         MinpvMode::ModeEnum m_minpvMode;
@@ -212,6 +273,22 @@ namespace Opm {
 
         mutable std::optional<std::vector<double>> active_volume;
 
+        template <typename T>
+        struct CellGeometry {
+            std::vector<T> center_x;
+            std::vector<T> center_y;
+            std::vector<T> center_z;
+            std::vector<T> depth;
+            std::vector<T> dx;
+            std::vector<T> dy;
+            std::vector<T> dz;
+            std::vector<T> volume;
+        };
+
+        mutable GeometryCache geometry_cache_mode = GeometryCache::None;
+        mutable std::optional<CellGeometry<double>> cell_geometry;
+        mutable std::optional<CellGeometry<float>> cell_geometry_float;
+
         bool m_circle = false;
 
         size_t zcorn_fixed = 0;
@@ -276,6 +353,38 @@ namespace Opm {
                             std::array<double,8>& X,
                             std::array<double,8>& Y,
                             std::array<double,8>& Z) const;
+        double cellVolume(std::size_t globalIndex,
+                          const std::array<double,8>& X,
+                          const std::array<double,8>& Y,
+                          const std::array<double,8>& Z) const;
+
+        template <typename T>
+        void buildCellGeometry(CellGeometry<T>& geometry) const;
+
+        /*
+          Calls func with the cached cell geometry, which is built first if
+          needed. Returns false, without calling func, if caching is off.
+        */
+        template <typename Func>
+        bool visitCellGeometry(Func&& func) const {
+            switch (this->geometry_cache_mode) {
+            case GeometryCache::Double:
+                if (!this->cell_geometry.has_value())
+                    this->buildCellGeometry(this->cell_geometry.emplace());
+                func(this->cell_geometry.value());
+                return true;
+
+            case GeometryCache::Float:
+                if (!this->cell_geometry_float.has_value())
+                    this->buildCellGeometry(this->cell_geometry_float.emplace());
+                func(this->cell_geometry_float.value());
+                return true;
+
+            case GeometryCache::None:
+                break;
+            }
+            return false;
+        }
 
    };
 
@@ -71,6 +71,17 @@ namespace Fieldprops
 
         FieldData() = default;
 
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(data);
+            serializer.template vector<value::status, false>(value_status);
+            kw_info.serializeOp(serializer);
+            serializer(global_data);
+            serializer(global_value_status);
+            serializer(all_set);
+        }
+
         FieldData(const keywords::keyword_info<T>& info, std::size_t active_size, std::size_t global_size) :
             data(std::vector<T>(active_size)),
             value_status(active_size, value::status::uninitialized),
@@ -119,6 +130,13 @@ namespace Fieldprops
             }
         }
 
+        void copy(const FieldData<T>& src, const std::vector<std::size_t>& active_index_list) {
+            for (const auto active_index : active_index_list) {
+                this->data[active_index] = src.data[active_index];
+                this->value_status[active_index] = src.value_status[active_index];
+            }
+        }
+
         void default_assign(T value) {
             std::fill(this->data.begin(), this->data.end(), value);
             std::fill(this->value_status.begin(), this->value_status.end(), value::status::valid_default);
@@ -238,6 +238,15 @@ public:
     */
     virtual std::vector<char> serialize_tran() const;
     virtual void deserialize_tran(const std::vector<char>& buffer);
+
+    /*
+      Binary image of the complete FieldProps state, used when storing a
+      snapshot of the EclipseState. The grid is not part of the image and
+      must be supplied when the image is unpacked; the FieldPropsManager
+      keeps a pointer to the grid.
+    */
+    std::vector<char> serialize() const;
+    void deserialize(const std::vector<char>& buffer, const EclipseGrid& grid);
 private:
     /*
       Return the keyword values as a std::vector<>. All elements in the return
@@ -47,6 +47,16 @@ struct keyword_info {
     }
 
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(unit);
+        serializer(scalar_init);
+        serializer(multiplier);
+        serializer(top);
+        serializer(global);
+    }
+
     keyword_info<T>& init(T init_value) {
         this->scalar_init = init_value;
         return *this;
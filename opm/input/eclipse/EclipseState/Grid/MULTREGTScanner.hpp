@@ -21,6 +21,11 @@
 #ifndef OPM_PARSER_MULTREGTSCANNER_HPP
 #define OPM_PARSER_MULTREGTSCANNER_HPP
 
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 
 
@@ -97,6 +102,14 @@ namespace Opm {
 
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
 
+        /*
+          Batch version of getRegionMultiplier(); the three input vectors
+          describe one face each and must have equal length.
+        */
+        std::vector<double> getRegionMultipliers(const std::vector<std::size_t>& globalCellIdx1,
+                                                 const std::vector<std::size_t>& globalCellIdx2,
+                                                 const std::vector<FaceDir::DirEnum>& faceDir) const;
+
         bool operator==(const MULTREGTScanner& data) const;
         MULTREGTScanner& operator=(const MULTREGTScanner& data);
 
@@ -113,9 +126,24 @@ namespace Opm {
                 constructSearchMap(searchMap);
             serializer(regions);
             serializer(default_region);
+            if (!serializer.isSerializing())
+                buildRegionTables();
         }
 
     private:
+        /*
+          Dense lookup table for the MULTREGT records of one region
+          set. The region value of each cell is translated to a compact
+          index, and the record of a region pair is then found directly
+          at position (index1 * num_regions + index2) in record_index.
+        */
+        struct RegionTable {
+            std::vector<int> cell_region;
+            std::size_t num_regions = 0;
+            std::vector<int> record_index;
+        };
+
+        void buildRegionTables();
         ExternalSearchMap getSearchMap() const;
         void constructSearchMap(const ExternalSearchMap& searchMap);
 
@@ -127,6 +155,7 @@ namespace Opm {
         std::map<std::string , MULTREGTSearchMap> m_searchMap;
         std::map<std::string, std::vector<int>> regions;
         std::string default_region;
+        std::vector<RegionTable> m_regionTables;
     };
 
 }
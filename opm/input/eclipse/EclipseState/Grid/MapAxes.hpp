@@ -53,6 +53,17 @@ public:
     const std::vector<float>& input() const;
     bool operator==(const MapAxes& other) const;
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer.template array<std::array<double, 2>, false>(origin);
+        serializer.template array<std::array<double, 2>, false>(unit_x);
+        serializer.template array<std::array<double, 2>, false>(unit_y);
+        serializer(m_input);
+        serializer(inv_norm);
+        serializer(map_units);
+    }
+
 private:
     MapAxes(double length_factor, double X1, double Y1, double X2, double Y2, double X3, double Y3);
     void init(double length_factor, double X1, double Y1, double X2, double Y2, double X3, double Y3);
@@ -85,6 +85,19 @@ namespace Opm { namespace satfunc {
                    this->maximum.gas == other.maximum.gas &&
                    this->maximum.water == other.maximum.water;
         }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(connate.gas);
+            serializer(connate.water);
+            serializer(critical.oil_in_gas);
+            serializer(critical.oil_in_water);
+            serializer(critical.gas);
+            serializer(critical.water);
+            serializer(maximum.gas);
+            serializer(maximum.water);
+        }
     };
 
     /// Collection of unscaled/raw saturation function value range endpoints
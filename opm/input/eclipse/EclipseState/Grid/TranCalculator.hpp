@@ -50,9 +50,18 @@ public:
             return this->op == other.op &&
                    this->field == other.field;
         }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(op);
+            serializer(field);
+        }
     };
 
 
+    TranCalculator() = default;
+
     explicit TranCalculator(const std::string& name_arg) :
         m_name(name_arg)
     {}
@@ -88,6 +97,13 @@ public:
                this->actions == other.actions;
     }
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(m_name);
+        serializer.vector(actions);
+    }
+
 private:
     std::string m_name;
     std::vector<TranAction> actions;
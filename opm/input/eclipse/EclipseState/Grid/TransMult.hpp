@@ -30,9 +30,11 @@
 #define OPM_PARSER_TRANSMULT_HPP
 
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -55,6 +57,18 @@ namespace Opm {
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
+
+        /*
+          Multiply the transmissibilities of a list of faces with all the
+          multipliers which apply to them: the directional multiplier of the
+          cells on both sides of the face and the MULTREGT multiplier. The
+          face direction is seen from the first cell, i.e. the second cell
+          contributes with the multiplier of the opposite face.
+        */
+        void applyMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                              const std::vector<std::size_t>& globalCellIndex2,
+                              const std::vector<FaceDir::DirEnum>& faceDir,
+                              std::vector<double>& trans) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
@@ -68,12 +82,20 @@ namespace Opm {
             serializer(m_ny);
             serializer(m_nz);
             // map used to avoid explicit instances with FaceDir::DirEnum in serializer
-            serializer.template map<decltype(m_trans),false>(m_trans);
+            TransMap trans = getTransMap();
+            serializer.template map<TransMap,false>(trans);
+            if (!serializer.isSerializing())
+                setTransMap(trans);
             serializer.template map<decltype(m_names),false>(m_names);
             m_multregtScanner.serializeOp(serializer);
         }
 
     private:
+        using TransMap = std::map<FaceDir::DirEnum , std::vector<double>>;
+
+        TransMap getTransMap() const;
+        void setTransMap(const TransMap& trans);
+
         size_t getGlobalIndex(size_t i , size_t j , size_t k) const;
         void assertIJK(size_t i , size_t j , size_t k) const;
         double getMultiplier__(size_t globalIndex , FaceDir::DirEnum faceDir) const;
@@ -81,7 +103,9 @@ namespace Opm {
         std::vector<double>& getDirectionProperty(FaceDir::DirEnum faceDir);
 
         size_t m_nx = 0, m_ny = 0, m_nz = 0;
-        std::map<FaceDir::DirEnum , std::vector<double> > m_trans;
+        // One array per face direction, indexed with the bit position of
+        // FaceDir::DirEnum; an empty array means all multipliers are 1.
+        std::array<std::vector<double>, 6> m_trans;
         std::map<FaceDir::DirEnum , std::string> m_names;
         MULTREGTScanner m_multregtScanner;
     };
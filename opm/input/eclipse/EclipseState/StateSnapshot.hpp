@@ -0,0 +1,73 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_STATE_SNAPSHOT_HPP
+#define OPM_STATE_SNAPSHOT_HPP
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+namespace Opm {
+
+class Deck;
+class EclipseState;
+class Python;
+class Schedule;
+class SummaryConfig;
+
+/*
+  The StateSnapshot class stores the fully initialized EclipseState,
+  Schedule and SummaryConfig of a deck in a binary file, so that a later
+  run of the same deck can skip parsing and the construction of the input
+  objects.
+
+  The snapshot file contains a format version, a fingerprint of the
+  opm-common build and its keyword definitions, the size and content hash
+  of the data file and all INCLUDE and IMPORT files of the deck and a
+  checksum of the payload. A snapshot is only loaded if the version and
+  the build fingerprint match, the checksum is correct and none of the
+  input files have been modified; otherwise load() returns an empty
+  optional and the caller should fall back to parsing the deck.
+
+  The snapshot files are not portable between machines with different
+  endianness.
+*/
+
+class StateSnapshot {
+public:
+    static void save(const std::filesystem::path& fname,
+                     const Deck& deck,
+                     const EclipseState& eclipse_state,
+                     const Schedule& schedule,
+                     const SummaryConfig& summary_config);
+
+    static std::optional<StateSnapshot> load(const std::filesystem::path& fname,
+                                             std::shared_ptr<const Python> python);
+
+    // The FieldPropsManager of the EclipseState refers to the grid of the
+    // EclipseState, the objects are therefore kept on the heap.
+    std::shared_ptr<EclipseState> eclipse_state;
+    std::shared_ptr<Schedule> schedule;
+    std::shared_ptr<SummaryConfig> summary_config;
+};
+
+}
+
+#endif
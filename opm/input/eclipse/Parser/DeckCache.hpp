@@ -0,0 +1,86 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace Opm {
+
+class Deck;
+
+/*
+  Size and content hash of an input file, used to detect whether a cached
+  image derived from the file is stale.
+*/
+struct InputFileStamp {
+    std::string fname;
+    std::size_t size = 0;
+    std::size_t hash = 0;
+
+    static InputFileStamp make(const std::string& fname);
+    bool current() const;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(fname);
+        serializer(size);
+        serializer(hash);
+    }
+};
+
+/*
+  The DeckCache class maintains a directory of binary images of parsed
+  decks. Each image starts with a header listing all the files in the
+  DeckTree of the deck - i.e. the data file and all INCLUDE and IMPORT
+  files - with the size and a content hash of each file. An image is only
+  used when all the listed files are unchanged; the image is then memory
+  mapped and the Deck is deserialized with Deck::serializeOp().
+
+  The images are keyed by the data file and a fingerprint of the parser
+  configuration, i.e. the library version, the definitions of the known
+  keywords and the ParseContext error modes. Stale or corrupt images are
+  silently ignored, and store() replaces the image atomically so several
+  processes can share the same cache directory.
+*/
+
+class DeckCache {
+public:
+    DeckCache(const std::filesystem::path& directory, std::size_t fingerprint);
+
+    // Returns the cached deck of data_file, or an empty optional if there
+    // is no valid image of data_file in the cache.
+    std::optional<Deck> load(const std::string& data_file) const;
+    void store(const std::string& data_file, const Deck& deck) const;
+
+    std::filesystem::path cacheFile(const std::string& data_file) const;
+
+private:
+    std::filesystem::path m_directory;
+    std::size_t m_fingerprint;
+};
+
+}
+
+#endif
@@ -34,6 +34,8 @@ public:
 
     explicit operator bool() const { return !this->error_list.empty(); }
 
+    const std::vector<std::pair<std::string, std::string>>& warnings() const { return this->warning_list; }
+
     /*
       Observe that this desctructor has a somewhat special semantics. If there
       are errors in the error list it will print all warnings and errors on
@@ -25,6 +25,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,6 +87,26 @@ namespace Opm {
 
         Deck parseStream(std::unique_ptr<std::istream>&& inputStream , const ParseContext& parseContext, ErrorGuard& errors) const;
 
+        /// Number of threads used to convert large data keywords like ZCORN
+        /// and PERMX while the deck is read. The keywords are added to the
+        /// deck in input order, and the deck is identical to the deck from a
+        /// serial parse. The default value 1 gives serial parsing, while 0
+        /// selects the number of hardware threads.
+        void setThreads(std::size_t threads);
+        std::size_t threads() const;
+
+        /// Opt-in cache of parsed decks. When a cache directory is set,
+        /// parseFile() stores a binary image of every deck parsed without
+        /// errors or warnings in that directory. A later parseFile() of the
+        /// same data file loads the deck from the image, provided the data
+        /// file and all include files are unchanged; see DeckCache.
+        void setDeckCache(const std::filesystem::path& directory);
+
+        /// Fingerprint of the library version and the definitions of all
+        /// keywords known to the parser. Caches of objects created from
+        /// parsed input use it to detect input from a different parser.
+        std::size_t keywordFingerprint() const;
+
         /// Method to add ParserKeyword instances, these holding type and size information about the keywords and their data.
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword parserKeyword);
@@ -160,6 +181,10 @@ namespace Opm {
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+
+        std::size_t m_threads = 1;
+        std::optional<std::filesystem::path> m_deck_cache;
+        bool m_default_keywords = false;
     };
 
 } // namespace Opm
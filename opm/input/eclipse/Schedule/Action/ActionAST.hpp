@@ -33,6 +33,7 @@ namespace Action {
 
 class Context;
 class ASTNode;
+class Program;
 
 
 /*
@@ -48,7 +49,10 @@ public:
 
     static AST serializeObject();
 
+    // The condition is compiled to an Action::Program when the AST is
+    // created; eval_tree() evaluates the syntax tree directly.
     Result eval(const Context& context) const;
+    Result eval_tree(const Context& context) const;
 
     bool operator==(const AST& data) const;
 
@@ -56,10 +60,14 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+        if (!serializer.isSerializing())
+            program.reset();
     }
     void required_summary(std::unordered_set<std::string>& required_summary) const;
 
 private:
+    const Program& compiled() const;
+
     /*
       The use of a pointer here is to be able to create this class with only a
       forward declaration of the ASTNode class. Would have prefered to use a
@@ -67,6 +75,7 @@ private:
       shared_ptr does not imply any shared ownership of the ASTNode.
     */
     std::shared_ptr<ASTNode> condition;
+    mutable std::shared_ptr<Program> program;
 };
 }
 }
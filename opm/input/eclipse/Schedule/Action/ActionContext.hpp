@@ -52,11 +52,20 @@ public:
 
     std::vector<std::string> wells(const std::string& func) const;
     const WListManager& wlist_manager() const;
+    const SummaryState& summary() const;
+
+    /*
+      True if values have been added with add(); the month names which are
+      added by the constructor are not counted. When false get() only
+      depends on the month names and the SummaryState.
+    */
+    bool has_user_values() const;
 
 private:
     const SummaryState& summary_state;
     const WListManager& wlm;
     std::map<std::string, double> values;
+    bool user_values = false;
 };
 }
 }
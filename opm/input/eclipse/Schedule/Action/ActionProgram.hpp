@@ -0,0 +1,138 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_PROGRAM_HPP
+#define ACTION_PROGRAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+namespace Opm {
+
+class WListManager;
+
+namespace Action {
+
+class Context;
+
+/*
+  The Action::Program class is the compiled form of an ACTIONX condition. The
+  tree is flattened into a list of instructions in pre-order, where every
+  instruction knows where its subtree ends so that the evaluation of AND and
+  OR can skip the remaining operands when they can no longer change the
+  result. The well patterns and well lists of the condition are resolved to
+  SummaryState handles, which are reused for as long as the layout and the
+  well names of the SummaryState and the well lists are unchanged, and the
+  sets of matching wells are bitsets over a table of well names.
+
+  Evaluating the program gives the same truth value and matching wells as
+  ASTNode::eval(); operands which are skipped are not evaluated, so errors
+  from missing summary variables in those operands are not raised. A program
+  is not reentrant, it must not be evaluated by several threads concurrently.
+*/
+
+class Program {
+public:
+    explicit Program(const ASTNode& condition);
+
+    Result eval(const Context& context) const;
+    std::size_t size() const;
+
+private:
+    enum class OpCode {
+        And,
+        Or,
+        Compare,
+        Invalid
+    };
+
+    enum class OperandKind {
+        Number,
+        Scalar,
+        Well,
+        WellPattern,
+        WellList
+    };
+
+    struct Operand {
+        OperandKind kind = OperandKind::Number;
+        double number = 0;
+        std::string func;
+        std::string key;
+        std::string well;
+        std::optional<double> month;
+
+        // Resolved well names and handles of a well pattern or well list.
+        mutable bool resolved = false;
+        mutable std::size_t layout_id = 0;
+        mutable std::size_t names_version = 0;
+        mutable std::vector<std::string> names;
+        mutable std::vector<std::size_t> well_index;
+        mutable std::vector<std::optional<SummaryState::Handle>> handles;
+        mutable std::optional<SummaryState::Handle> handle;
+    };
+
+    struct Instruction {
+        OpCode op;
+        std::size_t end;
+        std::size_t depth;
+        bool has_wells = false;
+        bool wells_matter = false;
+        TokenType cmp = TokenType::error;
+        Operand lhs;
+        Operand rhs;
+
+        // The original node of an Invalid instruction, evaluated only to
+        // raise the error of the syntax tree.
+        std::optional<ASTNode> node;
+    };
+
+    struct Register {
+        bool value = false;
+        std::vector<std::uint64_t> wells;
+    };
+
+    std::vector<Instruction> code;
+    mutable std::vector<Register> registers;
+    mutable std::vector<std::string> well_names;
+    mutable std::unordered_map<std::string, std::size_t> well_table;
+
+    void compile(const ASTNode& node, std::size_t depth, bool wells_matter);
+    Operand compile_operand(const ASTNode& node) const;
+    std::size_t execute(std::size_t index, const Context& context) const;
+    void compare(const Instruction& instruction, Register& reg, const Context& context) const;
+    double value(const Operand& operand, const Context& context) const;
+    double well_value(const Operand& operand, std::size_t index, const Context& context) const;
+    void resolve(const Operand& operand, const Context& context) const;
+    std::size_t well_id(const std::string& well) const;
+};
+
+}
+}
+
+#endif
@@ -54,6 +54,7 @@ public:
             template<class Serializer>
             void serializeOp(Serializer& serializer)
             {
+                serializer(this->active_index);
                 serializer(this->permx);
                 serializer(this->permy);
                 serializer(this->permz);
@@ -64,6 +65,7 @@ public:
 
             static Props serializeObject(){
                 Props props;
+                props.active_index = 12;
                 props.permx = 10.0;
                 props.permy = 78.0;
                 props.permz = 45.4;
@@ -26,6 +26,7 @@
 #include <ostream>
 #include <string>
 #include <unordered_map>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -139,6 +140,28 @@ namespace Opm
     };
 
 
+    /*
+      Estimate of the memory held by the snapshots of a Schedule. Objects
+      which are shared between report steps are counted once, at the first
+      report step which references them. The size of an object is the size
+      of its binary serialization, i.e. the payload without the allocator
+      and container overhead. The members are keyed by type name; the
+      shared properties of the wells are counted separately as
+      e.g. "Well::Connections", and the "Well" entry is the remainder.
+    */
+    struct ScheduleMemoryReport {
+        struct Member {
+            std::size_t count = 0;
+            std::size_t bytes = 0;
+        };
+
+        std::vector<std::size_t> step_bytes;
+        std::map<std::string, Member> members;
+
+        std::size_t total_bytes() const;
+    };
+
+
     class Schedule {
     public:
         Schedule() = default;
@@ -291,6 +314,19 @@ namespace Opm
 
         const ScheduleState& back() const;
         const ScheduleState& operator[](std::size_t index) const;
+
+        // Serializes every distinct object of the snapshots; meant for
+        // diagnostics and not for use in a simulation loop.
+        ScheduleMemoryReport memoryReport() const;
+
+        /*
+          The generation is incremented whenever the schedule is modified
+          after construction, e.g. by ACTIONX or when the simulator shuts a
+          well. Consumers which cache information derived from the schedule -
+          including Well pointers - must refresh their caches when the
+          generation changes.
+        */
+        std::size_t generation() const { return this->m_generation; }
         std::vector<ScheduleState>::const_iterator begin() const;
         std::vector<ScheduleState>::const_iterator end() const;
         void create_next(const time_point& start_time, const std::optional<time_point>& end_time);
@@ -310,6 +346,9 @@ namespace Opm
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            if (!serializer.isSerializing())
+                this->m_generation++;
+
             m_sched_deck.serializeOp(serializer);
             serializer.vector(snapshots);
             m_static.serializeOp(serializer);
@@ -455,6 +494,7 @@ namespace Opm
             }
 
             for (const auto& [key, values] : storage) {
+                std::shared_ptr<T> previous;
                 for (std::size_t unique_index = 0; unique_index < values.size(); unique_index++) {
                     const auto& [time_index, value] = values[unique_index];
                     auto last_index = this->snapshots.size();
@@ -464,6 +504,15 @@ namespace Opm
                     auto& map_value = this->snapshots[time_index].template get_map<K,T>();
                     map_value.update(std::move(value));
 
+                    // Consecutive versions of a well share the properties
+                    // which have not changed, as when the Schedule is built.
+                    if constexpr (std::is_same_v<T, Well>) {
+                        const auto current = map_value.get_ptr(key);
+                        if (previous)
+                            current->shareProperties(*previous);
+                        previous = current;
+                    }
+
                     for (std::size_t index=time_index + 1; index < last_index; index++) {
                         auto& forward_map = this->snapshots[index].template get_map<K,T>();
                         forward_map.update( key, map_value );
@@ -524,6 +573,7 @@ namespace Opm
         std::vector<ScheduleState> snapshots;
         WriteRestartFileEvents restart_output;
         CompletedCells completed_cells;
+        std::size_t m_generation = 0;
 
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
@@ -557,6 +607,9 @@ namespace Opm
                                     const ScheduleGrid& grid,
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix);
+        std::size_t reuseSnapshots(std::size_t report_step,
+                                   const ScheduleState& before_action,
+                                   std::vector<ScheduleState>&& previous);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -236,6 +236,9 @@ namespace Opm {
                     if (!ptr2)
                         return false;
 
+                    if (ptr1 == ptr2)
+                        continue;
+
                     if (!(*ptr1 == *ptr2))
                         return false;
                 }
@@ -21,11 +21,14 @@
 #define SUMMARY_STATE_H
 
 #include <chrono>
+#include <cstddef>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include <opm/common/utility/TimeService.hpp>
@@ -68,12 +71,80 @@ class UDQSet;
 
 class SummaryState {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    /*
+      A Handle is a precompiled reference to one summary variable. The
+      handle is created once with one of the handle() methods, which register
+      the variable and assign it a slot in flat arrays of values; subsequent
+      updates and lookups through the handle are plain array indexing without
+      any string hashing. A handle is only valid for the SummaryState instance
+      which created it - and copies of that instance - but it remains valid
+      across erase() and deserialize().
+
+      A handle for a well variable updates both the general value
+      'WWCT:OPX' and the specialized well value, exactly like
+      update_well_var("OPX", "WWCT", value).
+    */
+    class Handle {
+    public:
+        Handle() = default;
+        bool valid() const { return this->key_slot != npos; }
+
+    private:
+        friend class SummaryState;
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        Handle(std::size_t key_slot_arg, std::size_t var_slot_arg, bool total_arg) :
+            key_slot(key_slot_arg),
+            var_slot(var_slot_arg),
+            total(total_arg)
+        {}
+
+        std::size_t key_slot = npos;
+        std::size_t var_slot = npos;
+        bool total = false;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string, double>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const std::string&, double>;
+        using pointer = void;
+
+        reference operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        friend class SummaryState;
+        const_iterator(const SummaryState* state_arg, std::size_t index_arg);
+        void skip_absent();
+
+        const SummaryState* state;
+        std::size_t index;
+    };
+
     explicit SummaryState(time_point sim_start_arg);
 
     // The std::time_t constructor is only for export to Python
     explicit SummaryState(std::time_t sim_start_arg);
 
+    Handle handle(const std::string& key);
+    Handle well_var_handle(const std::string& well, const std::string& var);
+    Handle group_var_handle(const std::string& group, const std::string& var);
+    Handle conn_var_handle(const std::string& well, const std::string& var, std::size_t global_index);
+
+    /*
+      Handles for variables which have already been registered; unlike
+      handle() and well_var_handle() these will not register new variables
+      and can be used with a const SummaryState.
+    */
+    std::optional<Handle> find_handle(const std::string& key) const;
+    std::optional<Handle> find_well_var_handle(const std::string& well, const std::string& var) const;
+
     /*
       The set() function has to be retained temporarily to support updating of
       cumulatives from restart files.
@@ -84,6 +155,7 @@ public:
     bool erase_well_var(const std::string& well, const std::string& var);
     bool erase_group_var(const std::string& group, const std::string& var);
 
+    bool has(const Handle& handle) const;
     bool has(const std::string& key) const;
     bool has_well_var(const std::string& well, const std::string& var) const;
     bool has_well_var(const std::string& var) const;
@@ -92,6 +164,7 @@ public:
     bool has_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const;
 
 
+    void update(const Handle& handle, double value);
     void update(const std::string& key, double value);
     void update_well_var(const std::string& well, const std::string& var, double value);
     void update_group_var(const std::string& group, const std::string& var, double value);
@@ -99,6 +172,8 @@ public:
     void update_udq(const UDQSet& udq_set, double undefined_value);
     void update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value);
 
+    double get(const Handle& handle) const;
+    double get(const Handle& handle, double) const;
     double get(const std::string&) const;
     double get(const std::string&, double) const;
     double get_elapsed() const;
@@ -120,24 +195,91 @@ public:
     std::size_t num_wells() const;
     std::size_t size() const;
     bool operator==(const SummaryState& other) const;
+
+    /*
+      Identifies the slot layout of this instance; handles can be cached
+      and reused for as long as layout_id() is unchanged. A new id is
+      assigned when an instance is created, copied or assigned to.
+    */
+    std::size_t layout_id() const;
+
+    /*
+      Change counters used to skip the evaluation of quantities derived
+      from the SummaryState, e.g. UDQs, when their input is unchanged.
+      version(var) changes every time a value of var - for any well or
+      group when var is a well or group variable - is added, changed or
+      erased, and names_version() changes when a well or group is added to
+      or removed from wells() or groups(). The counters of one instance can
+      only be compared for as long as layout_id() is unchanged.
+    */
+    std::size_t version(const std::string& var) const;
+    std::size_t names_version() const;
 private:
+    struct LayoutId {
+        LayoutId();
+        LayoutId(const LayoutId&);
+        LayoutId& operator=(const LayoutId&);
+        std::size_t value;
+    };
+
+    template <class T>
+    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+
     time_point sim_start;
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
+    LayoutId m_layout;
+
+    // All values - general and specialized - are stored in slots of these
+    // flat arrays; a slot is allocated the first time a variable is
+    // referenced and is never released. Erased values are just flagged as
+    // absent.
+    std::vector<double> m_values;
+    std::vector<char> m_present;
+
+    // The owner of each slot; the well and group names of the specialized
+    // values are used to maintain the lists of wells and groups.
+    struct SlotOwner {
+        enum class Kind { General, Well, Group, Connection };
+        Kind kind;
+        std::string name;
+        std::size_t var;
+    };
+    std::vector<SlotOwner> m_slots;
+
+    // The change counter of each variable, indexed with SlotOwner::var; the
+    // variable of a general value is the full key.
+    std::unordered_map<std::string, std::size_t> version_index;
+    std::vector<std::size_t> m_var_versions;
+    std::size_t m_version = 0;
+    std::size_t m_names_version = 0;
+
+    // The general values, in the order they were registered.
+    std::unordered_map<std::string, std::size_t> key_index;
+    std::vector<std::pair<std::string, std::size_t>> m_keys;
 
     // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    map2<std::size_t> well_index;
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
     // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    map2<std::size_t> group_index;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
     // The first key is the variable and the second key is the well and the
     // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    map2<std::unordered_map<std::size_t, std::size_t>> conn_index;
+
+    std::size_t add_slot(SlotOwner::Kind kind, const std::string& name, const std::string& var);
+    std::size_t key_slot(const std::string& key);
+    std::size_t var_slot(map2<std::size_t>& index, SlotOwner::Kind kind, const std::string& name, const std::string& var);
+    std::optional<std::size_t> find_key(const std::string& key) const;
+    void update_slot(std::size_t slot, bool total, double value);
+    bool present(const std::optional<std::size_t>& slot) const;
+    void reset_values();
+    void changed(std::size_t slot);
+    void names_changed();
 };
 
 
@@ -61,6 +61,7 @@ public:
 
     bool operator==(const UDQASTNode& data) const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
+    void required_udq(std::unordered_set<std::string>& udq_keys) const;
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
@@ -75,6 +76,8 @@ public:
     }
 
 private:
+    friend class UDQProgram;
+
     UDQTokenType type;
     void func_tokens(std::set<UDQTokenType>& tokens) const;
 
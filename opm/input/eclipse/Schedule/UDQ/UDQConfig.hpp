@@ -23,7 +23,9 @@
 #include <string>
 #include <unordered_map>
 #include <map>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
@@ -103,11 +105,37 @@ namespace Opm {
             serializer.template map<decltype(type_count),false>(type_count);
             // The UDQFunction table is constant up to udq_params.
             // So we can just construct a new instance here.
-            if (!serializer.isSerializing())
+            if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+                m_eval_plan.reset();
+            }
         }
 
     private:
+        /*
+          The DEFINE statements in the order they are evaluated, with the
+          summary variables and UDQs read by each of them. The defines are
+          grouped in levels: the defines in one level only read UDQs
+          evaluated in earlier levels - or UDQs which should still have the
+          value from the previous evaluation - and can therefore be
+          evaluated concurrently. Defines using the random number functions
+          are placed in separate levels to preserve the sequence of random
+          numbers.
+        */
+        struct EvalNode {
+            std::string keyword;
+            std::vector<std::string> summary_keys;
+            std::vector<std::string> udq_keys;
+            bool random = false;
+        };
+
+        struct EvalPlan {
+            std::vector<EvalNode> nodes;
+            std::vector<std::vector<std::size_t>> levels;
+        };
+
+        const EvalPlan& eval_plan() const;
+
         void add_node(const std::string& quantity, UDQAction action);
         UDQAction action_type(const std::string& udq_key) const;
         void eval_assign(std::size_t report_step, SummaryState& st, UDQState& udq_state, UDQContext& context) const;
@@ -134,6 +162,8 @@ namespace Opm {
         IOrderSet<std::string> define_order;
         OrderedMap<std::string, UDQIndex> input_index;
         std::map<UDQVarType, std::size_t> type_count;
+
+        mutable std::shared_ptr<const EvalPlan> m_eval_plan;
     };
 }
 
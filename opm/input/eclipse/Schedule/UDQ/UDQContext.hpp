@@ -46,6 +46,7 @@ namespace Opm {
         void update_assign(std::size_t report_step, const std::string& keyword, const UDQSet& udq_result);
         void update_define(std::size_t report_step, const std::string& keyword, const UDQSet& udq_result);
         const UDQFunctionTable& function_table() const;
+        SummaryState& summary() const;
         std::vector<std::string> wells() const;
         std::vector<std::string> wells(const std::string& pattern) const;
         std::vector<std::string> groups() const;
@@ -21,6 +21,7 @@
 #ifndef UDQ_DEFINE_HPP
 #define UDQ_DEFINE_HPP
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -37,6 +38,7 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQProgram;
 class ParseContext;
 class ErrorGuard;
 
@@ -69,13 +71,21 @@ public:
 
     static UDQDefine serializeObject();
 
+    // The expression is compiled to a UDQProgram when the define is
+    // created; eval_tree() evaluates the syntax tree directly.
     UDQSet eval(const UDQContext& context) const;
+    UDQSet eval_tree(const UDQContext& context) const;
     const std::string& keyword() const;
     const std::string& input_string() const;
     const KeywordLocation& location() const;
     UDQVarType  var_type() const;
     std::set<UDQTokenType> func_tokens() const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
+    void required_udq(std::unordered_set<std::string>& udq_keys) const;
+
+    // Prepares eval() for the current SummaryState layout; eval() can be
+    // called concurrently for different defines after bind().
+    void bind(const UDQContext& context) const;
     void update_status(UDQUpdate update_status, std::size_t report_step);
     std::pair<UDQUpdate, std::size_t> status() const;
     const std::vector<Opm::UDQToken> tokens() const;
@@ -87,6 +97,8 @@ public:
     {
         serializer(m_keyword);
         serializer(ast);
+        if (!serializer.isSerializing())
+            m_program.program.reset();
         serializer(m_var_type);
         m_location.serializeOp(serializer);
         serializer(string_data);
@@ -95,9 +107,29 @@ public:
     }
 
 private:
+    // The compiled program keeps its registers and SummaryState handles
+    // between evaluations and is not reentrant. A copy of the define
+    // therefore does not share the program of the original, but compiles
+    // its own on first use.
+    struct ProgramCache {
+        ProgramCache() = default;
+        ProgramCache(const ProgramCache&) {}
+        ProgramCache(ProgramCache&&) = default;
+        ProgramCache& operator=(const ProgramCache&) { program.reset(); return *this; }
+        ProgramCache& operator=(ProgramCache&&) = default;
+
+        std::shared_ptr<UDQProgram> program;
+    };
+
+    const UDQProgram& compiled() const;
+
+    template <typename Evaluator>
+    UDQSet eval_with(Evaluator&& evaluator, const UDQContext& context) const;
+
     std::string m_keyword;
     std::vector<Opm::UDQToken> m_tokens;
     std::shared_ptr<UDQASTNode> ast;
+    mutable ProgramCache m_program;
     UDQVarType m_var_type;
     KeywordLocation m_location;
     std::size_t m_report_step;
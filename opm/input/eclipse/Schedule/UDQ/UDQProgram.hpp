@@ -0,0 +1,115 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+/*
+  The UDQProgram class is the compiled form of the expression tree of a UDQ
+  DEFINE. The tree is flattened into a list of instructions in evaluation
+  order; each instruction writes its result to a register and reads its
+  arguments from the registers written by earlier instructions. The keywords,
+  selectors and functions of the tree are resolved when the program is
+  compiled, summary well and group variables are read through SummaryState
+  handles which are created on first use, and the registers are reused
+  between evaluations.
+
+  Evaluating the program gives the same result as UDQASTNode::eval(). A
+  program is not reentrant, it must not be evaluated by several threads
+  concurrently.
+*/
+
+class UDQProgram {
+public:
+    explicit UDQProgram(const UDQASTNode& ast);
+
+    // Creates the SummaryState handles of the program up front; eval()
+    // does not register new variables in the SummaryState after this.
+    void bind(const UDQContext& context) const;
+    UDQSet eval(UDQVarType target_type, const UDQContext& context) const;
+    std::size_t size() const;
+
+private:
+    enum class OpCode {
+        WellVar,
+        WellVarSelected,
+        WellVarPattern,
+        GroupVar,
+        GroupVarSelected,
+        GroupVarPattern,
+        FieldVar,
+        ScalarVar,
+        Number,
+        ScalarFunction,
+        UnaryFunction,
+        BinaryFunction,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Error
+    };
+
+    // The SummaryState handles of a well/group variable, for the list of
+    // wells/groups the handles were created for.
+    struct Handles {
+        std::size_t layout_id = 0;
+        std::vector<std::string> names;
+        std::vector<SummaryState::Handle> handles;
+    };
+
+    struct Instruction {
+        OpCode op;
+        std::size_t result;
+        std::string keyword;
+        std::string selector;
+        double value = 0;
+        double sign = 1.0;
+        bool udq = false;
+        mutable std::optional<Handles> handles;
+    };
+
+    std::vector<Instruction> code;
+    std::size_t num_registers = 0;
+    mutable std::vector<std::optional<UDQSet>> registers;
+
+    void compile(const UDQASTNode& node, std::size_t reg);
+    void execute(const Instruction& instruction, UDQVarType target_type, const UDQContext& context) const;
+    UDQSet load_well_var(const Instruction& instruction, const std::vector<std::string>& all_wells, const std::vector<std::string>& wells, const UDQContext& context) const;
+    UDQSet load_group_var(const Instruction& instruction, const std::vector<std::string>& groups, const UDQContext& context) const;
+    const std::vector<SummaryState::Handle>& handles(const Instruction& instruction, const std::vector<std::string>& names, bool wells, SummaryState& st) const;
+};
+
+}
+
+#endif
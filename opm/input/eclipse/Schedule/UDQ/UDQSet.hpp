@@ -20,6 +20,9 @@
 #ifndef UDQSET_HPP
 #define UDQSET_HPP
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -63,8 +66,42 @@ public:
 };
 
 
+/*
+  The UDQSet class stores the values of a UDQ expression for a set of wells
+  or groups in columnar form: the values are stored in a contiguous array
+  of doubles, with a separate array of flags telling whether each value is
+  defined. The well/group names are stored in a name index which is shared
+  between all sets with the same names, and looking up an element by name
+  is a hash lookup. The arithmetic operators combine the elements of two
+  sets by position, and are implemented as plain loops over the arrays.
+
+  Element access with operator[] and through the iterators returns the
+  elements as UDQScalar instances by value.
+*/
+
 class UDQSet {
 public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = UDQScalar;
+        using pointer = const UDQScalar*;
+        using reference = UDQScalar;
+
+        const_iterator(const UDQSet* udq_set, std::size_t index);
+
+        UDQScalar operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        const UDQSet* udq_set;
+        std::size_t index;
+    };
+
     UDQSet(const std::string& name, UDQVarType var_type);
     UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames);
     UDQSet(const std::string& name, UDQVarType var_type, std::size_t size);
@@ -98,10 +135,16 @@ public:
     void operator/=(const UDQSet& rhs);
     void operator/=(double rhs);
 
-    const UDQScalar& operator[](std::size_t index) const;
-    const UDQScalar& operator[](const std::string& wgname) const;
-    std::vector<UDQScalar>::const_iterator begin() const;
-    std::vector<UDQScalar>::const_iterator end() const;
+    UDQScalar operator[](std::size_t index) const;
+    UDQScalar operator[](const std::string& wgname) const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Direct access to the element at position index; get() throws
+    // std::invalid_argument if the element is not defined.
+    bool defined(std::size_t index) const;
+    double get(std::size_t index) const;
+    const std::string& wgname(std::size_t index) const;
 
     std::vector<std::string> wgnames() const;
     std::vector<double> defined_values() const;
@@ -111,11 +154,22 @@ public:
     UDQVarType var_type() const;
     bool operator==(const UDQSet& other) const;
 private:
+    struct NameIndex {
+        std::vector<std::string> names;
+        std::unordered_map<std::string, std::size_t> lookup;
+    };
+
     UDQSet() = default;
+    static std::shared_ptr<const NameIndex> make_index(const std::vector<std::string>& wgnames);
+    std::optional<std::size_t> find(const std::string& wgname) const;
+    void assign_matching(const std::string& wgname, const std::optional<double>& value);
+    void set(std::size_t index, double value);
 
     std::string m_name;
     UDQVarType m_var_type = UDQVarType::NONE;
-    std::vector<UDQScalar> values;
+    std::shared_ptr<const NameIndex> m_index;
+    std::vector<double> m_values;
+    std::vector<char> m_defined;
 };
 
 
@@ -20,6 +20,8 @@
 #ifndef UDQSTATE_HPP_
 #define UDQSTATE_HPP_
 
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -33,6 +35,8 @@ namespace RestartIO {
     struct RstState;
 }
 
+class SummaryState;
+
 class UDQState {
 public:
     UDQState() = default;
@@ -53,6 +57,9 @@ public:
     bool define(const std::string& udq_key, std::pair<UDQUpdate, std::size_t> update_status) const;
     double undefined_value() const;
 
+    // Changes every time the values of udq_key are changed.
+    std::size_t version(const std::string& udq_key) const;
+
     std::vector<char> serialize() const;
     void deserialize(const std::vector<char>& buffer);
     bool operator==(const UDQState& other) const;
@@ -97,6 +104,9 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
+        if (!serializer.isSerializing())
+            this->eval_cache.reset();
+
         serializer(this->undef_value);
         serializer.template map<std::unordered_map<std::string, double>, false>(this->scalar_values);
         serializer.template map<std::unordered_map<std::string, std::size_t>, false>(this->assignments);
@@ -108,6 +118,30 @@ public:
 
 
 private:
+    friend class UDQConfig;
+
+    /*
+      Bookkeeping for the incremental evaluation of the DEFINE statements
+      in UDQConfig::eval(): the expression of each DEFINE and the versions
+      of its input and output when it was last evaluated. The records are
+      only valid for one report step, SummaryState layout and list of
+      wells/groups; they are not serialized or compared.
+    */
+    struct DefineRecord {
+        std::string expression;
+        std::vector<std::size_t> versions;
+    };
+
+    struct EvalCache {
+        std::size_t report_step;
+        std::size_t summary_layout;
+        std::size_t summary_names;
+        std::vector<std::string> wells;
+        std::unordered_map<std::string, DefineRecord> defines;
+    };
+
+    std::unordered_map<std::string, DefineRecord>& define_records(std::size_t report_step, const SummaryState& st, const std::vector<std::string>& wells);
+
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
     double undef_value;
@@ -116,6 +150,10 @@ private:
     std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
     std::unordered_map<std::string, std::size_t> assignments;
     std::unordered_map<std::string, std::size_t> defines;
+
+    std::unordered_map<std::string, std::size_t> versions;
+    std::size_t m_version = 0;
+    std::optional<EvalCache> eval_cache;
 };
 }
 
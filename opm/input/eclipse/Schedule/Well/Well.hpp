@@ -634,6 +634,17 @@ public:
     bool cmp_structure(const Well& other) const;
     bool operator==(const Well& data) const;
     bool hasSameConnectionsPointers(const Well& other) const;
+
+    /*
+      The unit system and the property objects of a well are shared between
+      the copies of the well in the different report steps, and are only
+      replaced when they are changed. After deserialization every version
+      of a well has its own property objects; shareProperties() replaces the
+      property objects which compare equal to those of @other with the
+      instances of @other.
+    */
+    void shareProperties(const Well& other);
+    const UnitSystem& units() const;
     void setInsertIndex(std::size_t index);
     double convertDeckPI(double deckPI) const;
     void applyWellProdIndexScaling(const double       scalingFactor,
@@ -652,7 +663,7 @@ public:
         serializer(headJ);
         serializer(ref_depth);
         serializer(wpave_ref_depth);
-        unit_system.serializeOp(serializer);
+        serializer(unit_system);
         serializer(udq_undefined);
         serializer(status);
         serializer(drainage_radius);
@@ -697,7 +708,7 @@ private:
     bool automatic_shutin;
     int pvt_table;
     GasInflowEquation gas_inflow = GasInflowEquation::STD;  // Will NOT be loaded/assigned from restart file
-    UnitSystem unit_system;
+    std::shared_ptr<UnitSystem> unit_system;
     double udq_undefined;
     WellType wtype;
     WellGuideRate guide_rate;
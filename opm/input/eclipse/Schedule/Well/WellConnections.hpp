@@ -24,7 +24,9 @@
 #include <opm/input/eclipse/Schedule/Well/Connection.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include <stddef.h>
@@ -95,6 +97,12 @@ namespace Opm {
         const Connection& lowest() const;
         Connection& getFromIJK(const int i, const int j, const int k);
         bool hasGlobalIndex(std::size_t global_index) const;
+
+        /// Look up several cells at once.  Returns the position - i.e. the
+        /// index for operator[] - of the connection in each of the cells
+        /// given by global cell index, with size() for the cells without a
+        /// connection.
+        std::vector<std::size_t> findGlobalIndices(const std::vector<std::size_t>& global_indices) const;
         double segment_perf_length(int segment) const;
 
         const_iterator begin() const { return this->m_connections.begin(); }
@@ -148,6 +156,8 @@ namespace Opm {
             serializer(headI);
             serializer(headJ);
             serializer.vector(m_connections);
+            if (!serializer.isSerializing())
+                this->rebuildIndex();
         }
 
     private:
@@ -174,9 +184,20 @@ namespace Opm {
         void orderMSW();
         void orderDEPTH();
 
+        std::optional<std::size_t> findIJK(int i, int j, int k) const;
+        std::optional<std::size_t> findGlobalIndex(std::size_t global_index) const;
+        void indexConnection(std::size_t pos);
+        void rebuildIndex();
+
         Connection::Order m_ordering = Connection::Order::TRACK;
         int headI, headJ;
         std::vector< Connection > m_connections;
+
+        // Position of the first connection in each cell, keyed on the
+        // global cell index and on the packed (i,j,k) coordinates.  Updated
+        // by all operations which add, remove or reorder connections.
+        std::unordered_map<std::size_t, std::size_t> m_global_index_map;
+        std::unordered_map<std::uint64_t, std::size_t> m_ijk_map;
     };
 
     std::optional<int>
@@ -0,0 +1,93 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_INPUT_PROFILER_HPP
+#define OPM_INPUT_PROFILER_HPP
+
+#include <chrono>
+#include <string>
+
+namespace Opm {
+
+class Schedule;
+
+/*
+  The InputProfiler class is a fully static class which collects the time
+  spent in the handlers of the keywords which build the Schedule and the
+  FieldProps, and the memory report of the last Schedule which was built.
+  The profiler is disabled by default; when it is disabled the
+  instrumentation only tests a flag.
+
+  The collected data is available as a JSON document:
+
+    {
+      "keywords": {
+        "Schedule": [ {"keyword": "WCONHIST", "calls": 120, "seconds": 0.25}, ... ],
+        "FieldProps": [ ... ]
+      },
+      "schedule_memory": {
+        "total_bytes": 123456,
+        "step_bytes": [ ... ],
+        "members": { "Well": {"count": 10, "bytes": 4096}, ... }
+      }
+    }
+
+  where the keywords of each category are sorted by decreasing time.
+
+  The Schedule constructor calls recordSchedule() when the profiler is
+  enabled. The memory report serializes every distinct object of the
+  snapshots, so with the profiler enabled this cost is included in the
+  time it takes to construct the Schedule, but not in any keyword timing.
+*/
+
+class InputProfiler {
+public:
+    class Timer {
+    public:
+        Timer(const char* category, const std::string& keyword);
+        ~Timer();
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+        const char* category = nullptr;
+        std::string keyword;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static void enable();
+    static void disable();
+    static bool enabled();
+    static void reset();
+
+    // Returns a Timer which records the time to its destruction for
+    // @keyword; does nothing if the profiler is disabled.
+    static Timer time(const char* category, const std::string& keyword);
+    static void record(const std::string& category, const std::string& keyword, double seconds);
+    static void recordSchedule(const Schedule& schedule);
+
+    static std::string json();
+    static void writeJson(const std::string& filename);
+    static void logJson();
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+   Copyright 2022 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_BYTESWAP_HPP
+#define OPM_IO_BYTESWAP_HPP
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+    // Bulk conversion between big endian (file) and native byte order for
+    // arrays of 4 and 8 byte elements. The implementation is selected at
+    // runtime based on the capabilities of the CPU; vectorized kernels are
+    // available for AVX2 and SSSE3 on x86 and for NEON on ARM, with a
+    // portable scalar kernel as fallback.
+
+    enum class ByteSwapKernel {
+        Scalar, SSSE3, AVX2, NEON
+    };
+
+    ByteSwapKernel activeByteSwapKernel();
+    std::vector<ByteSwapKernel> availableByteSwapKernels();
+    std::string byteSwapKernelName(ByteSwapKernel kernel);
+
+    // Swap count elements from src to dst, src and dst may be the same
+    // memory area but must otherwise not overlap.
+    void byteSwap32(const void* src, void* dst, std::size_t count);
+    void byteSwap64(const void* src, void* dst, std::size_t count);
+
+    // As above, with an explicitly selected kernel; mainly intended for
+    // testing and benchmarking. Throws std::invalid_argument if the kernel
+    // is not available on this CPU.
+    void byteSwap32(const void* src, void* dst, std::size_t count, ByteSwapKernel kernel);
+    void byteSwap64(const void* src, void* dst, std::size_t count, ByteSwapKernel kernel);
+
+    template <typename T>
+    void byteSwap(const T* src, T* dst, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T> && ((sizeof(T) == 4) || (sizeof(T) == 8)),
+                      "byteSwap is only supported for 4 and 8 byte arithmetic types");
+
+        if constexpr (sizeof(T) == 4)
+            byteSwap32(src, dst, count);
+        else
+            byteSwap64(src, dst, count);
+    }
+
+    template <typename T>
+    void byteSwap(T* data, std::size_t count)
+    {
+        byteSwap(data, data, count);
+    }
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_BYTESWAP_HPP
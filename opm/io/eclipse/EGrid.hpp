@@ -36,6 +36,7 @@ class EGrid : public EclFile
 {
 public:
     explicit EGrid(const std::string& filename, std::string grid_name = "global");
+    EGrid(const std::string& filename, EclFile::MemoryMapped mmap, std::string grid_name = "global");
 
     int global_index(int i, int j, int k) const;
     int active_index(int i, int j, int k) const;
@@ -38,6 +38,7 @@ class ERst : public EclFile
 {
 public:
     explicit ERst(const std::string& filename);
+    ERst(const std::string& filename, EclFile::MemoryMapped mmap);
 
     bool hasReportStepNumber(int number) const;
     bool hasLGR(const std::string& gridname, int reportStepNumber) const;
@@ -63,6 +64,12 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    template <typename T>
+    EclArrayView<T> getRestartView(const std::string& name, int reportStepNumber, int occurrence = 0)
+    {
+        return this->getView<T>(this->getArrayIndex(name, reportStepNumber, occurrence));
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
@@ -29,6 +29,7 @@
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/SummaryHistory.hpp>
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 namespace Opm { namespace EclIO {
@@ -52,6 +53,11 @@ public:
     const std::vector<float>& get(const SummaryNode& node) const;
     std::vector<time_point> dates() const;
 
+    // Values of @name at the time steps with t0 <= TIME <= t1.  Only the
+    // TIME vector and the time steps in the range are read from disk.
+    std::vector<float> get(const std::string& name, double t0, double t1) const;
+    SummaryHistory history(const std::vector<std::string>& vectList, double t0, double t1) const;
+
     std::vector<float> get_at_rstep(const std::string& name) const;
     std::vector<float> get_at_rstep(const SummaryNode& node) const;
     std::vector<time_point> dates_at_rstep() const;
@@ -149,6 +155,9 @@ private:
     std::vector<int> makeKeywPosVector(int speInd) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
 
+    std::vector<std::vector<float>> read_vectors(const std::vector<int>& keywIndVect, std::size_t first, std::size_t last) const;
+    std::pair<std::size_t, std::size_t> time_range(double t0, double t1) const;
+
     void read_ministeps_from_disk();
     int read_ministep_formatted(std::fstream& fileH);
 };
@@ -0,0 +1,162 @@
+/*
+   Copyright 2022 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/*
+  The EclArrayView class is a read-only view of a numeric array stored in an
+  unformatted (binary) ECLIPSE file which has been memory mapped. The data
+  is not copied, the elements are decoded from big endian to native byte
+  order when accessed, either one element at the time with operator[] or in
+  bulk with decode().
+
+  On disk the array is split in Fortran records of at most 1000 elements,
+  each record is enclosed in a four byte head and tail marker holding the
+  record length in bytes:
+
+     +------+---------------------+------+------+--------------+------+
+     | Head | 1000 elements       | Tail | Head | rest         | Tail |
+     +------+---------------------+------+------+--------------+------+
+
+  The position of element i is therefore computed from the record number
+  i / 1000 and the offset i % 1000 within that record. The record markers
+  are validated by decode(), not by the element access operator.
+
+  The view holds a shared reference to the underlying mapping, so it stays
+  valid also after the EclFile instance it was created from goes out of
+  scope.
+*/
+
+template <typename T>
+class EclArrayView {
+    static_assert(std::is_same_v<T, int> || std::is_same_v<T, unsigned int> ||
+                  std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "EclArrayView is only supported for int, unsigned int, float and double");
+
+public:
+    EclArrayView() = default;
+
+    EclArrayView(std::shared_ptr<const void> owner, const char* first_record, int64_t size)
+        : m_owner(std::move(owner))
+        , m_data(first_record)
+        , m_size(size)
+    {}
+
+    std::size_t size() const { return static_cast<std::size_t>(this->m_size); }
+    bool empty() const { return this->m_size == 0; }
+
+    T operator[](std::size_t index) const
+    {
+        const auto record = index / recordElements;
+        const auto offset = index % recordElements;
+        return decodeElement(this->m_data + record * recordBytes + sizeof(int) + offset * sizeof(T));
+    }
+
+    T at(std::size_t index) const
+    {
+        if (index >= this->size())
+            throw std::out_of_range("EclArrayView index " + std::to_string(index) + " out of range");
+
+        return (*this)[index];
+    }
+
+    // Decode the whole array into the memory area starting at output, which
+    // must have room for size() elements.
+    void decode(T* output) const
+    {
+        const char* record = this->m_data;
+        int64_t rest = this->m_size;
+
+        while (rest > 0) {
+            const auto num = static_cast<int>(std::min<int64_t>(rest, recordElements));
+            const auto head = decodeMarker(record);
+            const auto tail = decodeMarker(record + sizeof(int) + num * sizeof(T));
+
+            if (head != static_cast<int>(num * sizeof(T)))
+                throw std::runtime_error("Error reading memory mapped binary data, inconsistent header data or incorrect number of elements");
+
+            if (head != tail)
+                throw std::runtime_error("Error reading memory mapped binary data, tail not matching header.");
+
+            const char* src = record + sizeof(int);
+            for (int i = 0; i < num; i++)
+                output[i] = decodeElement(src + i * sizeof(T));
+
+            output += num;
+            rest -= num;
+            record += recordBytes;
+        }
+    }
+
+    std::vector<T> decode() const
+    {
+        std::vector<T> values(this->size());
+        this->decode(values.data());
+        return values;
+    }
+
+private:
+    static constexpr std::size_t recordElements = MaxBlockSizeInte / sizeOfInte;
+    static constexpr std::size_t recordBytes = recordElements * sizeof(T) + 2 * sizeof(int);
+
+    std::shared_ptr<const void> m_owner;
+    const char* m_data = nullptr;
+    int64_t m_size = 0;
+
+    static int decodeMarker(const char* src)
+    {
+        uint32_t raw;
+        std::memcpy(&raw, src, sizeof(raw));
+        return static_cast<int>(__builtin_bswap32(raw));
+    }
+
+    static T decodeElement(const char* src)
+    {
+        T value;
+        if constexpr (sizeof(T) == 4) {
+            uint32_t raw;
+            std::memcpy(&raw, src, sizeof(raw));
+            raw = __builtin_bswap32(raw);
+            std::memcpy(&value, &raw, sizeof(value));
+        } else {
+            uint64_t raw;
+            std::memcpy(&raw, src, sizeof(raw));
+            raw = __builtin_bswap64(raw);
+            std::memcpy(&value, &raw, sizeof(value));
+        }
+        return value;
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
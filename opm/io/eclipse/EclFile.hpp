@@ -19,16 +19,22 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
 
+namespace Opm {
+    class MappedFile;
+}
+
 namespace Opm { namespace EclIO {
 
 class EclFile
@@ -38,9 +44,18 @@ public:
         bool value;
     };
 
+    // In memory mapped mode the (unformatted) file is mapped into memory
+    // and arrays are decoded directly from the mapping. Formatted files
+    // are always read through a file stream.
+    struct MemoryMapped {
+        bool value;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return static_cast<bool>(mapped_file); }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -67,6 +82,16 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // Zero-copy access to numeric arrays in unformatted files; the file is
+    // memory mapped on first use if it was not opened in memory mapped
+    // mode. Supported types are int (INTE), float (REAL), double (DOUB) and
+    // unsigned int (raw LOGI values).
+    template <typename T>
+    EclArrayView<T> getView(int arrIndex);
+
+    template <typename T>
+    EclArrayView<T> getView(const std::string& name);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -91,6 +116,9 @@ protected:
 
     std::vector<uint64_t> ifStreamPos;
 
+    std::shared_ptr<const MappedFile> mapped_file;
+    std::shared_ptr<const MappedFile> view_mapping;
+
     std::map<std::string, int> array_index;
 
     template<class T>
@@ -105,6 +133,9 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadMappedArray(std::size_t arrIndex);
+    void mapFile();
+    const std::shared_ptr<const MappedFile>& viewMapping();
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, int64_t fromPos);
     void load(bool preload);
 
@@ -36,6 +36,9 @@ using ArrSourceEntry = std::tuple<std::string, std::string, int, uint64_t>;
 using TimeStepEntry = std::tuple<int, int, uint64_t>;
 using RstEntry = std::tuple<std::string, int>;
 
+// file offset of first summary vector (V0) and number of time steps in chunk
+using LodChunkEntry = std::tuple<uint64_t, int64_t>;
+
 // start, rstart + rstnum, keycheck, units, rstep, tstep
 using LodsmryHeadType = std::tuple<time_point, RstEntry, std::vector<std::string>, std::vector<std::string>,
                                     std::vector<int>, std::vector<int>>;
@@ -91,15 +94,14 @@ private:
     size_t m_nTstep;
     std::vector<int> m_seqIndex;
 
-    std::vector<uint64_t> m_lod_offset;
-    std::vector<uint64_t> m_lod_arr_size;
+    std::vector<std::vector<LodChunkEntry>> m_lod_chunks;
 
     time_point m_startdat;
 
     double m_io_opening;
     double m_io_loading;
 
-    uint64_t open_esmry(std::filesystem::path& inputFileName, LodsmryHeadType& lodsmry_head);
+    std::vector<LodChunkEntry> open_esmry(std::filesystem::path& inputFileName, LodsmryHeadType& lodsmry_head);
 
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
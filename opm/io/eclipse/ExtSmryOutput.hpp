@@ -19,7 +19,10 @@
 #ifndef OPM_IO_ExtSmryOutput_HPP
 #define OPM_IO_ExtSmryOutput_HPP
 
+#include <cstdint>
+#include <fstream>
 #include <string>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 
@@ -33,6 +36,28 @@ class EclipseState;
 namespace Opm { namespace EclIO {
 
 
+/*
+  The ESMRY file is written incrementally, the data is appended to the file
+  in place rather than rewriting it. The layout is
+
+     START, [RESTART, RSTNUM], KEYCHECK, UNITS, NSTEP,
+     RSTEP, TSTEP, V0 .. Vn-1,      (chunk 1)
+     RSTEP, TSTEP, V0 .. Vn-1,      (chunk 2)
+     ...
+
+  All arrays in a chunk are preallocated with the same number of elements
+  (the chunk capacity). When a chunk is full a new one is appended at the
+  end of the file, with capacity equal to the total capacity so far, i.e.
+  the total capacity is doubled.
+
+  The time steps passed to write() are buffered in memory, and written by
+  flush() as one contiguous block per vector. The number of valid time
+  steps is stored in NSTEP, which is updated by flush() after the data has
+  been written. A reader will hence always see a consistent set of time
+  steps, also while the simulation is running; the time steps which have
+  not yet been flushed are not visible.
+*/
+
 class ExtSmryOutput
 {
 
@@ -40,7 +65,10 @@ public:
     ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
                  const EclipseState& es, const time_t start_time);
 
+    ~ExtSmryOutput();
+
     void write(const std::vector<float>& ts_data, int report_step);
+    void flush();
 
 private:
 
@@ -49,14 +77,28 @@ private:
     int m_nVect;
     bool m_fmt;
 
+    std::fstream m_fileH;
+    uint64_t m_nstep_pos;
+    uint64_t m_chunk_offset;
+    uint64_t m_chunk_arr_size;
+    int m_chunk_first;
+    int m_capacity;
+
     std::vector<int> m_start_date_vect;
     std::string m_restart_rootn;
     int m_restart_step;
     std::vector<std::string> m_smry_keys;
     std::vector<std::string> m_smryUnits;
-    std::vector<int> m_rstep;
-    std::vector<int> m_tstep;
-    std::vector<std::vector<float>> m_smrydata;
+
+    std::vector<int> m_pending_rstep;
+    std::vector<std::vector<float>> m_pending_values;
+
+    void write_header();
+    void append_chunk();
+    uint64_t element_pos(int arr_ind, int step) const;
+
+    template <typename T>
+    void write_block(int arr_ind, const std::vector<T>& values);
 
     std::array<int, 3> ijk_from_global_index(const GridDims& dims, int globInd) const;
     std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys, const GridDims& dims);
@@ -0,0 +1,90 @@
+/*
+   Copyright 2022 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_SUMMARY_HISTORY_HPP
+#define OPM_IO_SUMMARY_HISTORY_HPP
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/*
+  The SummaryHistory class is an in-memory, column oriented store for the
+  values of a fixed set of summary vectors. The time steps are stored in
+  blocks of chunkSize steps, where every block holds the values of one
+  vector contiguously; appending a time step therefore never moves the
+  values which are already stored. The time values must be non-decreasing,
+  and the range queries select the time steps with t0 <= time <= t1 by
+  binary search on the time column.
+
+  The clear() method forgets the stored time steps but keeps the allocated
+  blocks, so that a history which is repeatedly filled and emptied does not
+  allocate after the first fill.
+*/
+
+class SummaryHistory
+{
+public:
+    explicit SummaryHistory(const std::vector<std::string>& keys = {}, std::size_t chunkSize = 1024);
+
+    void append(double time, const std::vector<float>& values);
+    void clear();
+
+    std::size_t size() const { return nStep; }
+    bool empty() const { return nStep == 0; }
+
+    const std::vector<std::string>& keys() const { return keyList; }
+    bool hasKey(const std::string& key) const;
+
+    double time(std::size_t step) const;
+    std::vector<double> times() const;
+    std::vector<double> times(double t0, double t1) const;
+
+    std::vector<float> get(const std::string& key) const;
+    std::vector<float> get(const std::string& key, double t0, double t1) const;
+
+    // Copies the values of all vectors at @step into @values, in the order
+    // of keys().
+    void row(std::size_t step, std::vector<float>& values) const;
+
+    // Returns the half-open range of time steps with t0 <= time <= t1.
+    std::pair<std::size_t, std::size_t> range(double t0, double t1) const;
+
+private:
+    std::size_t chunkSize;
+    std::size_t nStep = 0;
+    std::vector<std::string> keyList;
+    std::unordered_map<std::string, std::size_t> keyIndex;
+
+    // Block b holds the time steps [b*chunkSize, (b+1)*chunkSize), the
+    // values of vector k are at [k*chunkSize, (k+1)*chunkSize) in the block.
+    std::vector<std::vector<double>> timeBlocks;
+    std::vector<std::vector<float>> valueBlocks;
+
+    std::size_t index(const std::string& key) const;
+    std::vector<float> column(std::size_t key, std::size_t first, std::size_t last) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_SUMMARY_HISTORY_HPP
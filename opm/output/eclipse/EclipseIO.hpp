@@ -189,6 +189,40 @@ public:
                         RestartValue value,
                         const bool write_double = false);
 
+    /*
+      In asynchronous mode the restart and RFT files are written on a
+      dedicated output thread. The writeTimeStep() method then takes a
+      snapshot of the dynamic state - the RestartValue is moved, the
+      Action::State, WellTestState, SummaryState and UDQState objects are
+      copied - and returns as soon as the snapshot has been queued. At
+      most two snapshots are alive at any time: one being written and one
+      waiting in the queue; when both slots are taken writeTimeStep() will
+      block until the output thread has finished the oldest one.
+
+      The summary and RPT output is still written from the calling
+      thread. The EclipseState, grid and Schedule instances are shared
+      with the output thread; the lazily built geometry of the grid is
+      built when the asynchronous mode is enabled. The Schedule must not
+      be modified - e.g. by applying an ACTIONX - while output is pending;
+      call flush() first. A modification of the Schedule with output still
+      pending is detected by the next call to writeTimeStep() or flush(),
+      which then waits for the pending output and throws std::logic_error.
+
+      Errors on the output thread are rethrown from the next call to
+      writeTimeStep() or flush(). Disabling the asynchronous mode and
+      destroying the EclipseIO object will both wait for all pending
+      output to be written.
+    */
+    void setAsyncOutput(bool async_output);
+    bool asyncOutput() const;
+
+    /*
+      Wait until all pending restart and RFT output has been written. Will
+      rethrow an exception raised on the output thread. Does nothing if
+      the asynchronous mode is not enabled.
+    */
+    void flush();
+
 
     /*
       Will load solution data and wellstate from the restart
@@ -44,7 +44,7 @@ void python::common::export_SummaryState(py::module& module) {
 
     py::class_<SummaryState>(module, "SummaryState")
         .def(py::init<std::time_t>())
-        .def("update", &SummaryState::update)
+        .def("update", py::overload_cast<const std::string&, double>(&SummaryState::update))
         .def("update_well_var", &SummaryState::update_well_var)
         .def("update_group_var", &SummaryState::update_group_var)
         .def("well_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::get_well_var, py::const_))
@@ -52,7 +52,7 @@ void python::common::export_SummaryState(py::module& module) {
         .def("elapsed", &SummaryState::get_elapsed)
         .def_property_readonly("groups", groups)
         .def_property_readonly("wells", wells)
-        .def("__contains__", &SummaryState::has)
+        .def("__contains__", py::overload_cast<const std::string&>(&SummaryState::has, py::const_))
         .def("has_well_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::has_well_var, py::const_))
         .def("has_group_var", py::overload_cast<const std::string&, const std::string&>(&SummaryState::has_group_var, py::const_))
         .def("__getitem__", py::overload_cast<const std::string&>(&SummaryState::get, py::const_));
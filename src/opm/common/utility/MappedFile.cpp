@@ -0,0 +1,118 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/MappedFile.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define OPM_MAPPEDFILE_BUFFERED
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Opm {
+
+#ifdef OPM_MAPPEDFILE_BUFFERED
+
+MappedFile::MappedFile(const std::string& filename, Access)
+    : m_filename(filename)
+{
+    std::ifstream stream(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!stream)
+        throw std::runtime_error(fmt::format("Could not open file: {} for memory mapping", filename));
+
+    this->m_buffer.resize(static_cast<std::size_t>(stream.tellg()));
+    stream.seekg(0, std::ios::beg);
+    stream.read(this->m_buffer.data(), this->m_buffer.size());
+
+    this->m_data = this->m_buffer.data();
+    this->m_size = this->m_buffer.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+void MappedFile::prefetch(std::size_t, std::size_t) const
+{}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename, Access access)
+    : m_filename(filename)
+{
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error(fmt::format("Could not open file: {} for memory mapping - {}", filename, std::strerror(errno)));
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error(fmt::format("Could not determine size of file: {}", filename));
+    }
+
+    this->m_size = static_cast<std::size_t>(st.st_size);
+
+    // mmap() of a zero length range is an error; an empty file is
+    // represented by an empty, non-null range.
+    if (this->m_size == 0) {
+        ::close(fd);
+        this->m_data = "";
+        return;
+    }
+
+    void * addr = ::mmap(nullptr, this->m_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (addr == MAP_FAILED)
+        throw std::runtime_error(fmt::format("Memory mapping of file: {} failed - {}", filename, std::strerror(errno)));
+
+    ::madvise(addr, this->m_size, access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    this->m_data = static_cast<const char*>(addr);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->m_size > 0)
+        ::munmap(const_cast<char*>(this->m_data), this->m_size);
+}
+
+void MappedFile::prefetch(std::size_t offset, std::size_t length) const
+{
+    if (offset >= this->m_size)
+        return;
+
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto first = offset - (offset % page_size);
+    const auto last = std::min(offset + length, this->m_size);
+
+    ::madvise(const_cast<char*>(this->m_data) + first, last - first, MADV_WILLNEED);
+}
+
+#endif
+
+}
@@ -17,31 +17,160 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <regex>
-
 #include <opm/common/utility/shmatch.hpp>
 
+namespace Opm {
+
+ShellPattern::ShellPattern(const std::string& pattern) {
+    this->m_segments.emplace_back();
+    std::size_t pos = 0;
+    while (pos < pattern.size()) {
+        const char c = pattern[pos];
+        if (c == '*') {
+            this->m_is_literal = false;
+            if (!this->m_segments.back().empty() || this->m_segments.size() == 1)
+                this->m_segments.emplace_back();
+            pos++;
+            continue;
+        }
+
+        if (c == '?') {
+            this->m_is_literal = false;
+            this->m_segments.back().push_back({Element::Kind::Any, 0});
+            pos++;
+            continue;
+        }
+
+        if (c == '\\' && pos + 1 < pattern.size()) {
+            this->m_is_literal = false;
+            this->m_literal += pattern[pos + 1];
+            this->m_segments.back().push_back({Element::Kind::Char, static_cast<unsigned char>(pattern[pos + 1])});
+            pos += 2;
+            continue;
+        }
 
-bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
-    // Shell patterns should implicitly be interpreted as anchored at beginning
-    // and end.
-    std::string re_pattern = "^" + pattern + "$";
+        if (c == '[') {
+            // A ']' directly after the opening bracket, or the negation, is
+            // part of the set; a '[' without a closing ']' is an ordinary
+            // character.
+            auto start = pos + 1;
+            const bool negate = start < pattern.size() && (pattern[start] == '!' || pattern[start] == '^');
+            if (negate)
+                start++;
 
-    {
-        // Shell wildcard '*' should be regular expression arbitrary character '.'
-        // repeated arbitrary number of times '*'
-        std::regex re("\\*");
-        re_pattern = std::regex_replace(re_pattern, re, ".*");
+            const auto end = pattern.find(']', start + 1);
+            if (start < pattern.size() && end != std::string::npos) {
+                std::bitset<256> char_class;
+                for (auto index = start; index < end; index++) {
+                    const auto first = static_cast<unsigned char>(pattern[index]);
+                    if (index + 2 < end && pattern[index + 1] == '-') {
+                        const auto last = static_cast<unsigned char>(pattern[index + 2]);
+                        for (unsigned int ch = first; ch <= last; ch++)
+                            char_class.set(ch);
+                        index += 2;
+                    } else
+                        char_class.set(first);
+                }
+                if (negate)
+                    char_class.flip();
+
+                this->m_is_literal = false;
+                this->m_segments.back().push_back({Element::Kind::Class, this->m_classes.size()});
+                this->m_classes.push_back(char_class);
+                pos = end + 1;
+                continue;
+            }
+        }
+
+        this->m_literal += c;
+        this->m_segments.back().push_back({Element::Kind::Char, static_cast<unsigned char>(c)});
+        pos++;
     }
+}
+
 
-    {
-        // Shell wildcard '?' should be regular expression one arbitrary character
-        // '.'
-        std::regex re("\\?");
-        re_pattern = std::regex_replace(re_pattern, re, ".");
+bool ShellPattern::literal() const {
+    return this->m_is_literal;
+}
+
+
+bool ShellPattern::match_at(const Segment& segment, std::string_view symbol, std::size_t offset) const {
+    for (std::size_t index = 0; index < segment.size(); index++) {
+        const auto& element = segment[index];
+        const auto c = static_cast<unsigned char>(symbol[offset + index]);
+        switch (element.kind) {
+        case Element::Kind::Char:
+            if (c != element.value)
+                return false;
+            break;
+        case Element::Kind::Class:
+            if (!this->m_classes[element.value].test(c))
+                return false;
+            break;
+        case Element::Kind::Any:
+            break;
+        }
     }
+    return true;
+}
+
+
+/*
+  The first segment is anchored at the start of the symbol and the last
+  segment at the end, the segments in between are matched at the leftmost
+  position after the previous segment. Choosing the leftmost position
+  always leaves the most room for the remaining segments.
+*/
+bool ShellPattern::match(std::string_view symbol) const {
+    if (this->m_is_literal)
+        return symbol == this->m_literal;
 
-    std::regex regexp(re_pattern);
-    return std::regex_search(symbol, regexp);
+    const auto& first = this->m_segments.front();
+    if (this->m_segments.size() == 1)
+        return symbol.size() == first.size() && this->match_at(first, symbol, 0);
+
+    const auto& last = this->m_segments.back();
+    if (symbol.size() < first.size() + last.size())
+        return false;
+
+    if (!this->match_at(first, symbol, 0))
+        return false;
+
+    const auto end = symbol.size() - last.size();
+    if (!this->match_at(last, symbol, end))
+        return false;
+
+    auto pos = first.size();
+    for (std::size_t index = 1; index + 1 < this->m_segments.size(); index++) {
+        const auto& segment = this->m_segments[index];
+        while (true) {
+            if (pos + segment.size() > end)
+                return false;
+
+            if (this->match_at(segment, symbol, pos))
+                break;
+
+            pos++;
+        }
+        pos += segment.size();
+    }
+    return true;
 }
 
+
+bool shmatch(const std::string& pattern, const std::string& symbol) {
+    return ShellPattern(pattern).match(symbol);
+}
+
+
+std::vector<std::size_t> match_all(const std::string& pattern, const std::vector<std::string>& names) {
+    const ShellPattern shell_pattern(pattern);
+    std::vector<std::size_t> indices;
+    for (std::size_t index = 0; index < names.size(); index++) {
+        if (shell_pattern.match(names[index]))
+            indices.push_back(index);
+    }
+    return indices;
+}
+
+}
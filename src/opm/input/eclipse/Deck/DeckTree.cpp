@@ -18,6 +18,7 @@
 
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 
+#include <algorithm>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -82,6 +83,20 @@ const std::string& DeckTree::root() const {
     return this->root_file.value();
 }
 
+std::vector<std::string> DeckTree::files() const {
+    std::vector<std::string> file_list;
+    if (!this->root_file.has_value())
+        return file_list;
+
+    for (const auto& [fname, _] : this->nodes) {
+        if (fname != this->root_file.value())
+            file_list.push_back(fname);
+    }
+    std::sort(file_list.begin(), file_list.end());
+    file_list.insert(file_list.begin(), this->root_file.value());
+    return file_list;
+}
+
 void DeckTree::add_include(std::string parent_file, std::string include_file) {
     if (!this->root_file.has_value())
         return;
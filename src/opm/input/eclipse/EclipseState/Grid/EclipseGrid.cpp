@@ -88,6 +88,42 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
         v *= scale_factor;
 }
 
+std::array<double, 3> cell_center(const std::array<double,8>& X, const std::array<double,8>& Y, const std::array<double,8>& Z) {
+    return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                                    std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                                    std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+}
+
+double cell_depth(const std::array<double,8>& Z) {
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return (z1 + z2)/2.0;
+}
+
+double cell_thickness(const std::array<double,8>& Z) {
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return z2-z1;
+}
+
+std::array<double, 3> cell_dims(const std::array<double,8>& X, const std::array<double,8>& Y, const std::array<double,8>& Z) {
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    return std::array<double,3> {{dx, dy, cell_thickness(Z)}};
+}
+
 }
 
 EclipseGrid::EclipseGrid(const std::array<int, 3>& dims ,
@@ -195,6 +231,7 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
         zcorn_fixed = mapper.fixupZCORN( m_zcorn );
+        this->releaseGeometryCache();
     }
 
     resetACTNUM(actnum);
@@ -1431,13 +1468,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 std::array<double,8> Z;
                 auto global_index = this->m_active_to_global[active_index];
                 this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    auto& r = *m_rv;
-                    auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+                volume[active_index] = this->cellVolume(global_index, X, Y, Z);
             }
 
             this->active_volume = std::move(volume);
@@ -1447,6 +1478,21 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
 
+    double EclipseGrid::cellVolume(std::size_t globalIndex,
+                                   const std::array<double,8>& X,
+                                   const std::array<double,8>& Y,
+                                   const std::array<double,8>& Z) const {
+        if (m_rv && m_thetav) {
+            const auto[i,j,k] = this->getIJK(globalIndex);
+            auto& r = *m_rv;
+            auto& t = *m_thetav;
+            return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+        } else {
+            return calculateCellVol(X, Y, Z);
+        }
+    }
+
+
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
         if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
@@ -1454,18 +1500,15 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
             return this->active_volume.value()[active_index];
         }
 
+        double volume;
+        if (this->visitCellGeometry([&](const auto& geometry) { volume = geometry.volume[globalIndex]; }))
+            return volume;
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        if (m_rv && m_thetav) {
-            const auto[i,j,k] = this->getIJK(globalIndex);
-            auto& r = *m_rv;
-            auto& t = *m_thetav;
-           return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-        } else {
-            return calculateCellVol(X, Y, Z);
-        }
+        return this->cellVolume(globalIndex, X, Y, Z);
     }
 
     double EclipseGrid::getCellVolume(size_t i , size_t j , size_t k) const {
@@ -1485,47 +1528,31 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellThickness(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        double dz;
+        if (this->visitCellGeometry([&](const auto& geometry) { dz = geometry.dz[globalIndex]; }))
+            return dz;
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-        return dz;
+        return cell_thickness(Z);
     }
 
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        std::array<double, 3> dims;
+        if (this->visitCellGeometry([&](const auto& geometry) {
+                                        dims = {geometry.dx[globalIndex], geometry.dy[globalIndex], geometry.dz[globalIndex]};
+                                    }))
+            return dims;
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cell_dims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1539,13 +1566,17 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     std::array<double, 3> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        std::array<double, 3> center;
+        if (this->visitCellGeometry([&](const auto& geometry) {
+                                        center = {geometry.center_x[globalIndex], geometry.center_y[globalIndex], geometry.center_z[globalIndex]};
+                                    }))
+            return center;
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cell_center(X, Y, Z);
     }
 
 
@@ -1599,14 +1630,15 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellDepth(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        double depth;
+        if (this->visitCellGeometry([&](const auto& geometry) { depth = geometry.depth[globalIndex]; }))
+            return depth;
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+        return cell_depth(Z);
     }
 
     double EclipseGrid::getCellDepth(size_t i, size_t j, size_t k) const {
@@ -1615,6 +1647,53 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->getCellDepth(globalIndex);
     }
 
+    void EclipseGrid::setGeometryCache(GeometryCache mode) const {
+        if (mode != this->geometry_cache_mode)
+            this->releaseGeometryCache();
+
+        this->geometry_cache_mode = mode;
+    }
+
+    EclipseGrid::GeometryCache EclipseGrid::geometryCache() const {
+        return this->geometry_cache_mode;
+    }
+
+    void EclipseGrid::releaseGeometryCache() const {
+        this->cell_geometry.reset();
+        this->cell_geometry_float.reset();
+    }
+
+    void EclipseGrid::buildGeometryCache() const {
+        this->visitCellGeometry([](const auto&) {});
+    }
+
+    template <typename T>
+    void EclipseGrid::buildCellGeometry(CellGeometry<T>& geometry) const {
+        const auto global_size = this->getCartesianSize();
+        for (auto* data : {&geometry.center_x, &geometry.center_y, &geometry.center_z, &geometry.depth,
+                           &geometry.dx, &geometry.dy, &geometry.dz, &geometry.volume})
+            data->resize(global_size);
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t global_index = 0; global_index < global_size; global_index++) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+            this->getCellCorners(global_index, X, Y, Z );
+
+            const auto center = cell_center(X, Y, Z);
+            const auto dims = cell_dims(X, Y, Z);
+            geometry.center_x[global_index] = center[0];
+            geometry.center_y[global_index] = center[1];
+            geometry.center_z[global_index] = center[2];
+            geometry.depth[global_index] = cell_depth(Z);
+            geometry.dx[global_index] = dims[0];
+            geometry.dy[global_index] = dims[1];
+            geometry.dz[global_index] = dims[2];
+            geometry.volume[global_index] = this->cellVolume(global_index, X, Y, Z);
+        }
+    }
+
     const std::vector<int>& EclipseGrid::getACTNUM( ) const {
 
         return m_actnum;
@@ -1629,6 +1708,8 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->active_volume = std::nullopt;
+        this->releaseGeometryCache();
         return mapper.fixupZCORN( m_zcorn );
     }
 
@@ -45,6 +45,7 @@
 #include <opm/common/utility/Serializer.hpp>
 #include <opm/input/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquifers.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
+#include <opm/input/eclipse/Utility/InputProfiler.hpp>
 
 #include "FieldProps.hpp"
 #include "Operate.hpp"
@@ -235,46 +236,58 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info, const D
 }
 
 
-template <typename T>
-void assign_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const std::vector<Box::cell_index>& index_list) {
+/*
+  The scalar operations are applied either to the cells of a box, or to the
+  active cells of a region given by their active index.
+*/
+std::size_t active_index(const Box::cell_index& cell_index) {
+    return cell_index.active_index;
+}
+
+std::size_t active_index(const std::size_t cell_index) {
+    return cell_index;
+}
+
+template <typename T, typename IndexList>
+void assign_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const IndexList& index_list) {
     for (const auto& cell_index : index_list) {
-        data[cell_index.active_index] = value;
-        value_status[cell_index.active_index] = value::status::deck_value;
+        data[active_index(cell_index)] = value;
+        value_status[active_index(cell_index)] = value::status::deck_value;
     }
 }
 
-template <typename T>
-void multiply_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void multiply_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const IndexList& index_list) {
     for (const auto& cell_index : index_list) {
-        if (value::has_value(value_status[cell_index.active_index]))
-            data[cell_index.active_index] *= value;
+        if (value::has_value(value_status[active_index(cell_index)]))
+            data[active_index(cell_index)] *= value;
     }
 }
 
-template <typename T>
-void add_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void add_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const IndexList& index_list) {
     for (const auto& cell_index : index_list) {
-        if (value::has_value(value_status[cell_index.active_index]))
-            data[cell_index.active_index] += value;
+        if (value::has_value(value_status[active_index(cell_index)]))
+            data[active_index(cell_index)] += value;
     }
 }
 
-template <typename T>
-void min_value(std::vector<T>& data, std::vector<value::status>& value_status, T min_value, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void min_value(std::vector<T>& data, std::vector<value::status>& value_status, T min_value, const IndexList& index_list) {
     for (const auto& cell_index : index_list) {
-        if (value::has_value(value_status[cell_index.active_index])) {
-            T value = data[cell_index.active_index];
-            data[cell_index.active_index] = std::max(value, min_value);
+        if (value::has_value(value_status[active_index(cell_index)])) {
+            T value = data[active_index(cell_index)];
+            data[active_index(cell_index)] = std::max(value, min_value);
         }
     }
 }
 
-template <typename T>
-void max_value(std::vector<T>& data, std::vector<value::status>& value_status, T max_value, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void max_value(std::vector<T>& data, std::vector<value::status>& value_status, T max_value, const IndexList& index_list) {
     for (const auto& cell_index : index_list) {
-        if (value::has_value(value_status[cell_index.active_index])) {
-            T value = data[cell_index.active_index];
-            data[cell_index.active_index] = std::min(value, max_value);
+        if (value::has_value(value_status[active_index(cell_index)])) {
+            T value = data[active_index(cell_index)];
+            data[active_index(cell_index)] = std::min(value, max_value);
         }
     }
 }
@@ -487,6 +500,8 @@ FieldProps::FieldProps(const Deck& deck, const Phases& phases, const EclipseGrid
 
     if (DeckSection::hasSOLUTION(deck))
         this->scanSOLUTIONSection(SOLUTIONSection(deck));
+
+    this->release_region_index();
 }
 
 
@@ -526,6 +541,7 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum) {
 
     this->m_actnum = std::move(new_actnum);
     this->active_size = new_active_size;
+    this->release_region_index();
 }
 
 
@@ -648,22 +664,47 @@ Fieldprops::FieldData<int>& FieldProps::init_get(const std::string& keyword, boo
 }
 
 
-std::vector<Box::cell_index> FieldProps::region_index( const std::string& region_name, int region_value ) {
-    const auto& region = this->init_get<int>(region_name);
-    if (!region.valid())
-        throw std::invalid_argument("Trying to work with invalid region: " + region_name);
+/*
+  The region operations look up the cells of one region value per record;
+  to avoid a scan of the full grid for every record the active indices of
+  all the values of a region keyword are sorted into an index on first use.
+  The index of a region keyword must be invalidated with
+  invalidate_region_index() whenever the keyword or the ACTNUM changes, and
+  the whole index is released with release_region_index() when the deck
+  has been processed.
+*/
+const std::vector<std::size_t>& FieldProps::region_index( const std::string& region_name, int region_value ) {
+    static const std::vector<std::size_t> empty_index;
 
-    std::vector<Box::cell_index> index_list;
-    std::size_t active_index = 0;
-    const auto& region_data = region.data;
-    for (std::size_t g = 0; g < this->m_actnum.size(); g++) {
-        if (this->m_actnum[g] != 0) {
-            if (region_data[active_index] == region_value)
-                index_list.emplace_back( g, active_index, g );
-            active_index += 1;
-        }
+    auto index_iter = this->m_region_index.find(region_name);
+    if (index_iter == this->m_region_index.end()) {
+        const auto& region = this->init_get<int>(region_name);
+        if (!region.valid())
+            throw std::invalid_argument("Trying to work with invalid region: " + region_name);
+
+        RegionIndex index;
+        const auto& region_data = region.data;
+        for (std::size_t active_index = 0; active_index < region_data.size(); active_index++)
+            index[region_data[active_index]].push_back(active_index);
+
+        index_iter = this->m_region_index.emplace(region_name, std::move(index)).first;
     }
-    return index_list;
+
+    auto value_iter = index_iter->second.find(region_value);
+    if (value_iter == index_iter->second.end())
+        return empty_index;
+
+    return value_iter->second;
+}
+
+
+void FieldProps::invalidate_region_index(const std::string& keyword) {
+    this->m_region_index.erase(keyword);
+}
+
+
+void FieldProps::release_region_index() {
+    std::unordered_map<std::string, RegionIndex>().swap(this->m_region_index);
 }
 
 
@@ -726,6 +767,7 @@ std::vector<std::string> FieldProps::keys<int>() const {
 template <>
 void FieldProps::erase<int>(const std::string& keyword) {
     this->int_data.erase(keyword);
+    this->invalidate_region_index(keyword);
 }
 
 template <>
@@ -739,6 +781,7 @@ std::vector<int> FieldProps::extract<int>(const std::string& keyword) {
     auto field = std::move(field_iter->second);
     std::vector<int> data = std::move( field.data );
     this->int_data.erase( field_iter );
+    this->invalidate_region_index(keyword);
     return data;
 }
 
@@ -783,6 +826,7 @@ void FieldProps::handle_int_keyword(const Fieldprops::keywords::keyword_info<int
     const auto& deck_data = keyword.getIntData();
     const auto& deck_status = keyword.getValueStatus();
     assign_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
+    this->invalidate_region_index(keyword.name());
 }
 
 
@@ -812,8 +856,8 @@ void FieldProps::handle_double_keyword(Section section, const Fieldprops::keywor
 
 
 
-template <typename T>
-void FieldProps::apply(Fieldprops::ScalarOperation op, std::vector<T>& data, std::vector<value::status>& value_status, T scalar_value, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void FieldProps::apply(Fieldprops::ScalarOperation op, std::vector<T>& data, std::vector<value::status>& value_status, T scalar_value, const IndexList& index_list) {
     if (op == Fieldprops::ScalarOperation::EQUAL)
         assign_scalar(data, value_status, scalar_value, index_list);
 
@@ -844,8 +888,8 @@ double FieldProps::get_beta(const std::string& func_name, const std::string& tar
     return this->getSIValue(target_array, raw_beta);
 }
 
-template <typename T>
-void FieldProps::operate(const DeckRecord& record, Fieldprops::FieldData<T>& target_data, const Fieldprops::FieldData<T>& src_data, const std::vector<Box::cell_index>& index_list) {
+template <typename T, typename IndexList>
+void FieldProps::operate(const DeckRecord& record, Fieldprops::FieldData<T>& target_data, const Fieldprops::FieldData<T>& src_data, const IndexList& index_list) {
     const std::string& func_name = record.getItem("OPERATION").get< std::string >(0);
     const std::string& target_array = record.getItem("TARGET_ARRAY").get<std::string>(0);
     const double alpha           = this->get_alpha(func_name, target_array, record.getItem("PARAM1").get< double >(0));
@@ -860,10 +904,11 @@ void FieldProps::operate(const DeckRecord& record, Fieldprops::FieldData<T>& tar
         throw std::logic_error("The OPERATE keyword can not be used for manipulations of TRANX, TRANY or TRANZ");
 
     for (const auto& cell_index : index_list) {
-        if (value::has_value(src_data.value_status[cell_index.active_index])) {
-            if ((check_target == false) || (value::has_value(target_data.value_status[cell_index.active_index]))) {
-                target_data.data[cell_index.active_index]         = func(target_data.data[cell_index.active_index], src_data.data[cell_index.active_index]);
-                target_data.value_status[cell_index.active_index] = src_data.value_status[cell_index.active_index];
+        const auto active_index = Opm::active_index(cell_index);
+        if (value::has_value(src_data.value_status[active_index])) {
+            if ((check_target == false) || (value::has_value(target_data.value_status[active_index]))) {
+                target_data.data[active_index]         = func(target_data.data[active_index], src_data.data[active_index]);
+                target_data.value_status[active_index] = src_data.value_status[active_index];
             } else
                 throw std::invalid_argument("Tried to use unset property value in OPERATE/OPERATER keyword");
         } else
@@ -981,6 +1026,7 @@ void FieldProps::handle_operation(const DeckKeyword& keyword, Box box) {
             int scalar_value = static_cast<int>(record.getItem(1).get<double>(0));
             auto& field_data = this->init_get<int>(target_kw);
             FieldProps::apply(fromString(keyword.name()), field_data.data, field_data.value_status, scalar_value, box.index_list());
+            this->invalidate_region_index(target_kw);
             continue;
         }
 
@@ -993,35 +1039,35 @@ void FieldProps::handle_COPY(const DeckKeyword& keyword, Box box, bool region) {
     for (const auto& record : keyword) {
         const std::string& src_kw = Fieldprops::keywords::get_keyword_from_alias(record.getItem(0).get<std::string>(0));
         const std::string& target_kw = Fieldprops::keywords::get_keyword_from_alias(record.getItem(1).get<std::string>(0));
-        std::vector<Box::cell_index> index_list;
+        auto copy = [this, &src_kw, &target_kw](const auto& index_list)
+        {
+            if (FieldProps::supported<double>(src_kw)) {
+                const auto& src_data = this->try_get<double>(src_kw);
+                src_data.verify_status();
+
+                auto& target_data = this->init_get<double>(target_kw);
+                target_data.copy(src_data.field_data(), index_list);
+                return;
+            }
+
+            if (FieldProps::supported<int>(src_kw)) {
+                const auto& src_data = this->try_get<int>(src_kw);
+                src_data.verify_status();
+
+                auto& target_data = this->init_get<int>(target_kw);
+                target_data.copy(src_data.field_data(), index_list);
+                this->invalidate_region_index(target_kw);
+            }
+        };
 
         if (region) {
             int region_value = record.getItem(2).get<int>(0);
             const auto& region_item = record.getItem(3);
             const auto& region_name = this->region_name( region_item );
-            index_list = this->region_index(region_name, region_value);
+            copy(this->region_index(region_name, region_value));
         } else {
             box.update(record);
-            index_list = box.index_list();
-        }
-
-
-        if (FieldProps::supported<double>(src_kw)) {
-            const auto& src_data = this->try_get<double>(src_kw);
-            src_data.verify_status();
-
-            auto& target_data = this->init_get<double>(target_kw);
-            target_data.copy(src_data.field_data(), index_list);
-            continue;
-        }
-
-        if (FieldProps::supported<int>(src_kw)) {
-            const auto& src_data = this->try_get<int>(src_kw);
-            src_data.verify_status();
-
-            auto& target_data = this->init_get<int>(target_kw);
-            target_data.copy(src_data.field_data(), index_list);
-            continue;
+            copy(box.index_list());
         }
     }
 }
@@ -1096,8 +1142,8 @@ void FieldProps::init_porv(Fieldprops::FieldData<double>& porv) {
 
     for (const auto& mregp: this->multregp) {
         const auto& index_list = this->region_index(mregp.region_name, mregp.region_value);
-        for (const auto& cell_index : index_list)
-            porv_data[cell_index.active_index] *= mregp.multiplier;
+        for (const auto active_index : index_list)
+            porv_data[active_index] *= mregp.multiplier;
     }
 }
 
@@ -1152,6 +1198,7 @@ void FieldProps::scanGRIDSection(const GRIDSection& grid_section) {
     Box box(*this->grid_ptr);
 
     for (const auto& keyword : grid_section) {
+        const auto timer = InputProfiler::time("FieldProps", keyword.name());
         const std::string& name = keyword.name();
 
         if (Fieldprops::keywords::GRID::double_keywords.count(name) == 1) {
@@ -1171,6 +1218,7 @@ void FieldProps::scanGRIDSection(const GRIDSection& grid_section) {
 void FieldProps::scanEDITSection(const EDITSection& edit_section) {
     Box box(*this->grid_ptr);
     for (const auto& keyword : edit_section) {
+        const auto timer = InputProfiler::time("FieldProps", keyword.name());
         const std::string& name = keyword.name();
 
         auto tran_iter = this->tran.find(name);
@@ -1215,6 +1263,7 @@ void FieldProps::scanPROPSSection(const PROPSSection& props_section) {
     Box box(*this->grid_ptr);
 
     for (const auto& keyword : props_section) {
+        const auto timer = InputProfiler::time("FieldProps", keyword.name());
         const std::string& name = keyword.name();
         if (Fieldprops::keywords::PROPS::satfunc.count(name) == 1) {
             Fieldprops::keywords::keyword_info<double> sat_info{};
@@ -1241,6 +1290,7 @@ void FieldProps::scanREGIONSSection(const REGIONSSection& regions_section) {
     Box box(*this->grid_ptr);
 
     for (const auto& keyword : regions_section) {
+        const auto timer = InputProfiler::time("FieldProps", keyword.name());
         const std::string& name = keyword.name();
         if (Fieldprops::keywords::REGIONS::int_keywords.count(name)) {
             this->handle_int_keyword(Fieldprops::keywords::REGIONS::int_keywords.at(name), keyword, box);
@@ -1262,6 +1312,7 @@ void FieldProps::scanREGIONSSection(const REGIONSSection& regions_section) {
 void FieldProps::scanSOLUTIONSection(const SOLUTIONSection& solution_section) {
     Box box(*this->grid_ptr);
     for (const auto& keyword : solution_section) {
+        const auto timer = InputProfiler::time("FieldProps", keyword.name());
         const std::string& name = keyword.name();
         if (Fieldprops::keywords::SOLUTION::double_keywords.count(name) == 1) {
             this->handle_double_keyword(Section::SOLUTION, Fieldprops::keywords::SOLUTION::double_keywords.at(name), keyword, box);
@@ -1288,6 +1339,7 @@ void FieldProps::handle_schedule_keywords(const std::vector<DeckKeyword>& keywor
 
     for (const auto& keyword : keywords) {
         const std::string& name = keyword.name();
+        const auto timer = InputProfiler::time("FieldProps", name);
         if (Fieldprops::keywords::SCHEDULE::double_keywords.count(name) == 1) {
             this->handle_double_keyword(Section::SCHEDULE, Fieldprops::keywords::SCHEDULE::double_keywords.at(name), keyword, box);
             continue;
@@ -1328,6 +1380,10 @@ void FieldProps::deserialize_tran(const std::vector<char>& buffer) {
     Opm::deserialize_tran(this->tran, buffer);
 }
 
+void FieldProps::set_grid(const EclipseGrid& grid) {
+    this->grid_ptr = &grid;
+}
+
 bool FieldProps::tran_active(const std::string& keyword) const {
     auto calculator = this->tran.find(keyword);
     return calculator != this->tran.end() && calculator->second.size() > 0;
@@ -1359,6 +1415,9 @@ void FieldProps::apply_numerical_aquifers(const NumericalAquifers& numerical_aqu
         permy_data[active_index] = 0.;
         permz_data[active_index] = 0.;
     }
+
+    this->invalidate_region_index("SATNUM");
+    this->invalidate_region_index("PVTNUM");
 }
 
 
@@ -22,6 +22,7 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -296,6 +297,8 @@ public:
         std::string region_name;
 
 
+        MultregpRecord() = default;
+
         MultregpRecord(int rv, double m, const std::string& rn) :
             region_value(rv),
             multiplier(m),
@@ -308,6 +311,14 @@ public:
                    this->multiplier == other.multiplier &&
                    this->region_name == other.region_name;
         }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(region_value);
+            serializer(multiplier);
+            serializer(region_name);
+        }
     };
 
 
@@ -375,6 +386,11 @@ public:
 
 
     FieldProps(const Deck& deck, const Phases& phases, const EclipseGrid& grid, const TableManager& table_arg);
+
+    // Construct an empty instance to be filled with serializeOp(); the
+    // grid must be assigned with set_grid() before use.
+    FieldProps() = default;
+    void set_grid(const EclipseGrid& grid);
     void reset_actnum(const std::vector<int>& actnum);
 
     void apply_numerical_aquifers(const NumericalAquifers& numerical_aquifers);
@@ -498,6 +514,31 @@ public:
     void deserialize_tran(const std::vector<char>& buffer);
     bool operator==(const FieldProps& other) const;
     static bool rst_cmp(const FieldProps& full_arg, const FieldProps& rst_arg);
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(active_size);
+        serializer(global_size);
+        unit_system.serializeOp(serializer);
+        serializer(nx);
+        serializer(ny);
+        serializer(nz);
+        if (!serializer.isSerializing())
+            m_region_index.clear();
+        m_phases.serializeOp(serializer);
+        m_satfuncctrl.serializeOp(serializer);
+        serializer(m_actnum);
+        serializer(cell_volume);
+        serializer(cell_depth);
+        serializer(m_default_region);
+        tables.serializeOp(serializer);
+        serializer(m_rtep);
+        serializer.vector(multregp);
+        serializer.map(int_data);
+        serializer.map(double_data);
+        serializer.map(tran);
+    }
 private:
     void scanGRIDSection(const GRIDSection& grid_section);
     void scanEDITSection(const EDITSection& edit_section);
@@ -512,11 +553,11 @@ private:
     template <typename T>
     std::vector<T> extract(const std::string& keyword);
 
-    template <typename T>
-    void operate(const DeckRecord& record, Fieldprops::FieldData<T>& target_data, const Fieldprops::FieldData<T>& src_data, const std::vector<Box::cell_index>& index_list);
+    template <typename T, typename IndexList>
+    void operate(const DeckRecord& record, Fieldprops::FieldData<T>& target_data, const Fieldprops::FieldData<T>& src_data, const IndexList& index_list);
 
-    template <typename T>
-    static void apply(ScalarOperation op, std::vector<T>& data, std::vector<value::status>& value_status, T scalar_value, const std::vector<Box::cell_index>& index_list);
+    template <typename T, typename IndexList>
+    static void apply(ScalarOperation op, std::vector<T>& data, std::vector<value::status>& value_status, T scalar_value, const IndexList& index_list);
 
     template <typename T>
     Fieldprops::FieldData<T>& init_get(const std::string& keyword, bool allow_unsupported = false);
@@ -524,8 +565,14 @@ private:
     template <typename T>
     Fieldprops::FieldData<T>& init_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<T>& kw_info);
 
+    // The active indices of the cells of each value of a region keyword,
+    // built on first use.
+    using RegionIndex = std::unordered_map<int, std::vector<std::size_t>>;
+
     std::string region_name(const DeckItem& region_item);
-    std::vector<Box::cell_index> region_index( const std::string& region_name, int region_value );
+    const std::vector<std::size_t>& region_index( const std::string& region_name, int region_value );
+    void invalidate_region_index(const std::string& keyword);
+    void release_region_index();
     void handle_OPERATE(const DeckKeyword& keyword, Box box);
     void handle_operation(const DeckKeyword& keyword, Box box);
     void handle_region_operation(const DeckKeyword& keyword);
@@ -542,15 +589,15 @@ private:
     void init_porv(Fieldprops::FieldData<double>& porv);
     void init_tempi(Fieldprops::FieldData<double>& tempi);
 
-    const UnitSystem unit_system;
+    UnitSystem unit_system;
     std::size_t nx,ny,nz;
     Phases m_phases;
     SatFuncControls m_satfuncctrl;
     std::vector<int> m_actnum;
     std::vector<double> cell_volume;
     std::vector<double> cell_depth;
-    const std::string m_default_region;
-    const EclipseGrid * grid_ptr;      // A bit undecided whether to properly use the grid or not ...
+    std::string m_default_region;
+    const EclipseGrid * grid_ptr = nullptr;      // A bit undecided whether to properly use the grid or not ...
     TableManager tables;
     std::optional<satfunc::RawTableEndPoints> m_rtep;
     std::vector<MultregpRecord> multregp;
@@ -558,6 +605,7 @@ private:
     std::unordered_map<std::string, Fieldprops::FieldData<double>> double_data;
 
     std::unordered_map<std::string, Fieldprops::TranCalculator> tran;
+    std::unordered_map<std::string, RegionIndex> m_region_index;
 };
 
 }
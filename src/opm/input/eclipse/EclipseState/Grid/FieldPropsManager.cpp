@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
+#include <opm/common/utility/BinarySerializer.hpp>
 #include <opm/common/utility/Serializer.hpp>
 #include <opm/input/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquifers.hpp>
 
@@ -158,6 +159,17 @@ void FieldPropsManager::deserialize_tran(const std::vector<char>& buffer) {
     this->fp->deserialize_tran(buffer);
 }
 
+std::vector<char> FieldPropsManager::serialize() const {
+    return BinarySerializer::pack(*this->fp);
+}
+
+void FieldPropsManager::deserialize(const std::vector<char>& buffer, const EclipseGrid& grid) {
+    auto field_props = std::make_shared<FieldProps>();
+    BinarySerializer::unpack(buffer, *field_props);
+    field_props->set_grid(grid);
+    this->fp = std::move(field_props);
+}
+
 bool FieldPropsManager::tran_active(const std::string& keyword) const {
     return this->fp->tran_active(keyword);
 }
@@ -16,9 +16,11 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <cstdlib>
 #include <stdexcept>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
@@ -74,6 +76,49 @@ std::vector<int> unique(const std::vector<int>& data) {
     return { set_data.begin(), set_data.end() };
 }
 
+/*
+  Index of the record which applies to the face between two cells with the
+  compact region indices region1 and region2, or -1 if there is no such
+  record; the record for (region1 -> region2) has precedence over the
+  record for (region2 -> region1).
+*/
+int find_record(const std::vector<int>& record_index,
+                const std::size_t num_regions,
+                const std::vector<Opm::MULTREGTRecord>& records,
+                const int region1,
+                const int region2,
+                const Opm::FaceDir::DirEnum faceDir) {
+    int index = record_index[region1 * num_regions + region2];
+    if (index >= 0 && (records[index].directions & faceDir))
+        return index;
+
+    index = record_index[region2 * num_regions + region1];
+    if (index >= 0 && (records[index].directions & faceDir))
+        return index;
+
+    return -1;
+}
+
+bool nnc_applies(const Opm::MULTREGTRecord& record,
+                 const std::size_t nx,
+                 const std::size_t nz,
+                 const std::size_t globalIndex1,
+                 const std::size_t globalIndex2) {
+    int i1 = globalIndex1 % nx;
+    int i2 = globalIndex2 % nx;
+    int j1 = globalIndex1 / nx % nz;
+    int j2 = globalIndex2 / nx % nz;
+    bool neighbours = (std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0);
+
+    if (record.nnc_behaviour == Opm::MULTREGT::NNC)
+        return !neighbours;
+
+    if (record.nnc_behaviour == Opm::MULTREGT::NONNC)
+        return neighbours;
+
+    return true;
+}
+
 }
 
 
@@ -153,6 +198,8 @@ std::vector<int> unique(const std::vector<int>& data) {
 
             m_searchMap[keyword][pair] = record;
         }
+
+        this->buildRegionTables();
     }
 
     MULTREGTScanner MULTREGTScanner::serializeObject()
@@ -162,9 +209,10 @@ std::vector<int> unique(const std::vector<int>& data) {
         result.ny = 2;
         result.nz = 3;
         result.m_records = {{4, 5, 6.0, 7, MULTREGT::ALL, "test1"}};
-        result.constructSearchMap({{"test2", {{{8, 9}, 10}}}});
-        result.regions = {{"test3", {11}}};
+        result.constructSearchMap({{"test1", {{{8, 9}, 0}}}});
+        result.regions = {{"test1", {11}}};
         result.default_region = "test4";
+        result.buildRegionTables();
 
         return result;
     }
@@ -255,44 +303,113 @@ std::vector<int> unique(const std::vector<int>& data) {
 
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
+        for (const auto& table : this->m_regionTables) {
+            int regionIdx1 = table.cell_region[globalIndex1];
+            int regionIdx2 = table.cell_region[globalIndex2];
+            if (regionIdx1 < 0 || regionIdx2 < 0)
+                continue;
+
+            int record_index = find_record(table.record_index, table.num_regions, this->m_records, regionIdx1, regionIdx2, faceDir);
+            if (record_index < 0)
+                continue;
+
+            const auto& record = this->m_records[record_index];
+            if (nnc_applies(record, this->nx, this->nz, globalIndex1, globalIndex2))
+                return record.trans_mult;
+        }
+        return 1;
+    }
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            const auto& region_data = this->regions.at( iter->first );
-            const MULTREGTSearchMap& map = (*iter).second;
 
-            int regionId1 = region_data[globalIndex1];
-            int regionId2 = region_data[globalIndex2];
+    /*
+      Batch version of getRegionMultiplier(); the faces are evaluated in one
+      pass over each of the region tables, in the same order as the tables
+      are searched by getRegionMultiplier().
+    */
+    std::vector<double> MULTREGTScanner::getRegionMultipliers(const std::vector<std::size_t>& globalIndex1,
+                                                              const std::vector<std::size_t>& globalIndex2,
+                                                              const std::vector<FaceDir::DirEnum>& faceDir) const {
+        if (globalIndex1.size() != globalIndex2.size() || globalIndex1.size() != faceDir.size())
+            throw std::invalid_argument("MULTREGT: the cell and face direction vectors must have equal length");
+
+        const auto num_faces = globalIndex1.size();
+        std::vector<double> multipliers(num_faces, 1.0);
+        if (this->m_regionTables.empty())
+            return multipliers;
+
+        std::vector<char> resolved(num_faces, 0);
+        for (const auto& table : this->m_regionTables) {
+            const auto& cell_region = table.cell_region;
+            const auto& record_index = table.record_index;
+            const auto num_regions = table.num_regions;
+
+            for (std::size_t face = 0; face < num_faces; face++) {
+                if (resolved[face])
+                    continue;
 
-            std::pair<int,int> pair{ regionId1, regionId2 };
-            if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir))
+                int regionIdx1 = cell_region[globalIndex1[face]];
+                int regionIdx2 = cell_region[globalIndex2[face]];
+                if (regionIdx1 < 0 || regionIdx2 < 0)
                     continue;
+
+                int index = find_record(record_index, num_regions, this->m_records, regionIdx1, regionIdx2, faceDir[face]);
+                if (index < 0)
+                    continue;
+
+                const auto& record = this->m_records[index];
+                if (nnc_applies(record, this->nx, this->nz, globalIndex1[face], globalIndex2[face])) {
+                    multipliers[face] = record.trans_mult;
+                    resolved[face] = 1;
+                }
             }
-            const MULTREGTRecord* record = map.at(pair);
-
-            bool applyMultiplier = true;
-            int i1 = globalIndex1 % this->nx;
-            int i2 = globalIndex2 % this->nx;
-            int j1 = globalIndex1 / this->nx % this->nz;
-            int j2 = globalIndex2 / this->nx % this->nz;
-
-            if (record->nnc_behaviour == MULTREGT::NNC){
-                applyMultiplier = true;
-                if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
-                    applyMultiplier = false;
+        }
+
+        return multipliers;
+    }
+
+
+    /*
+      The search map is compiled into one dense table per region set. Only
+      the region values which are mentioned in the MULTREGT records get a
+      compact index; cells in other regions are marked with -1 and can not
+      get a multiplier from this region set. The tables are ordered like
+      the search map, so the first matching region set still wins.
+    */
+    void MULTREGTScanner::buildRegionTables() {
+        this->m_regionTables.clear();
+        for (const auto& [region_name, search_map] : this->m_searchMap) {
+            auto region_iter = this->regions.find(region_name);
+            if (region_iter == this->regions.end())
+                throw std::logic_error("MULTREGT: no region data for the region set " + region_name);
+
+            std::unordered_map<int, int> compact_index;
+            for (const auto& [pair, record] : search_map) {
+                for (int region_value : {pair.first, pair.second}) {
+                    if (compact_index.count(region_value) == 0) {
+                        int index = compact_index.size();
+                        compact_index.emplace(region_value, index);
+                    }
+                }
             }
-            else if (record->nnc_behaviour == MULTREGT::NONNC){
-                applyMultiplier = false;
-                if ((std::abs(i1-i2) == 0 && std::abs(j1-j2) == 1) || (std::abs(i1-i2) == 1 && std::abs(j1-j2) == 0))
-                    applyMultiplier = true;
+
+            RegionTable table;
+            table.num_regions = compact_index.size();
+            table.record_index.assign(table.num_regions * table.num_regions, -1);
+            for (const auto& [pair, record] : search_map) {
+                auto index1 = compact_index.at(pair.first);
+                auto index2 = compact_index.at(pair.second);
+                table.record_index[index1 * table.num_regions + index2] = record - this->m_records.data();
             }
 
-            if (applyMultiplier)
-                return record->trans_mult;
+            const auto& region_data = region_iter->second;
+            table.cell_region.resize(region_data.size());
+            for (std::size_t g = 0; g < region_data.size(); g++) {
+                auto index_iter = compact_index.find(region_data[g]);
+                table.cell_region[g] = index_iter == compact_index.end() ? -1 : index_iter->second;
+            }
 
+            this->m_regionTables.push_back(std::move(table));
         }
-        return 1;
     }
 
     MULTREGTScanner::ExternalSearchMap MULTREGTScanner::getSearchMap() const {
@@ -342,6 +459,7 @@ std::vector<int> unique(const std::vector<int>& data) {
         default_region = data.default_region;
         m_searchMap.clear();
         constructSearchMap(data.getSearchMap());
+        m_regionTables = data.m_regionTables;
 
         return *this;
     }
@@ -18,6 +18,7 @@
 */
 
 #include <stdexcept>
+#include <string>
 
 #include <fmt/format.h>
 
@@ -37,6 +38,31 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/M.hpp>
 
 
+namespace {
+
+std::size_t directionIndex(Opm::FaceDir::DirEnum faceDir) {
+    switch (faceDir) {
+    case Opm::FaceDir::XPlus:  return 0;
+    case Opm::FaceDir::XMinus: return 1;
+    case Opm::FaceDir::YPlus:  return 2;
+    case Opm::FaceDir::YMinus: return 3;
+    case Opm::FaceDir::ZPlus:  return 4;
+    case Opm::FaceDir::ZMinus: return 5;
+    }
+    throw std::invalid_argument("Invalid face direction: " + std::to_string(faceDir));
+}
+
+Opm::FaceDir::DirEnum directionFromIndex(std::size_t index) {
+    return static_cast<Opm::FaceDir::DirEnum>(1 << index);
+}
+
+// The opposite direction is the neighbouring bit: XPlus <-> XMinus, ...
+std::size_t oppositeIndex(std::size_t index) {
+    return index ^ 1;
+}
+
+}
+
 namespace Opm {
 
    TransMult::TransMult(const GridDims& dims, const Deck& deck, const FieldPropsManager& fp) :
@@ -67,7 +93,7 @@ namespace Opm {
         result.m_nx = 1;
         result.m_ny = 2;
         result.m_nz = 3;
-        result.m_trans = {{FaceDir::YPlus, {4.0, 5.0}}};
+        result.setTransMap({{FaceDir::YPlus, {4.0, 5.0}}});
         result.m_names = {{FaceDir::ZPlus, "test1"}};
         result.m_multregtScanner = MULTREGTScanner::serializeObject();
 
@@ -94,11 +120,11 @@ namespace Opm {
     }
 
     double TransMult::getMultiplier__(size_t globalIndex,  FaceDir::DirEnum faceDir) const {
-        if (hasDirectionProperty( faceDir )) {
-            const auto& data = m_trans.at(faceDir);
-            return data[globalIndex];
-        } else
+        const auto& data = m_trans[directionIndex(faceDir)];
+        if (data.empty())
             return 1.0;
+
+        return data[globalIndex];
     }
 
 
@@ -113,18 +139,69 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    void TransMult::applyMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                                     const std::vector<std::size_t>& globalCellIndex2,
+                                     const std::vector<FaceDir::DirEnum>& faceDir,
+                                     std::vector<double>& trans) const {
+        if (trans.size() != faceDir.size() ||
+            globalCellIndex1.size() != faceDir.size() ||
+            globalCellIndex2.size() != faceDir.size())
+            throw std::invalid_argument("The cell, face direction and transmissibility vectors must have equal length");
+
+        // The indices are validated before the region multipliers are
+        // looked up with them.
+        const std::size_t global_size = this->m_nx * this->m_ny * this->m_nz;
+        for (std::size_t face = 0; face < faceDir.size(); face++) {
+            if (globalCellIndex1[face] >= global_size || globalCellIndex2[face] >= global_size)
+                throw std::invalid_argument("Invalid global index");
+        }
+
+        std::vector<double> mult = this->m_multregtScanner.getRegionMultipliers(globalCellIndex1, globalCellIndex2, faceDir);
+        for (std::size_t face = 0; face < mult.size(); face++) {
+            const auto index = directionIndex(faceDir[face]);
+            const auto& data1 = this->m_trans[index];
+            const auto& data2 = this->m_trans[oppositeIndex(index)];
+            if (!data1.empty())
+                mult[face] *= data1[globalCellIndex1[face]];
+
+            if (!data2.empty())
+                mult[face] *= data2[globalCellIndex2[face]];
+        }
+
+        for (std::size_t face = 0; face < mult.size(); face++)
+            trans[face] *= mult[face];
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
-        return m_trans.count(faceDir) == 1;
+        return !m_trans[directionIndex(faceDir)].empty();
     }
 
 
     std::vector<double>& TransMult::getDirectionProperty(FaceDir::DirEnum faceDir) {
-        if (m_trans.count(faceDir) == 0) {
+        auto& data = m_trans[directionIndex(faceDir)];
+        if (data.empty()) {
             std::size_t global_size = this->m_nx * this->m_ny * this->m_nz;
-            m_trans[faceDir] = std::vector<double>(global_size, 1);
+            data.assign(global_size, 1);
+        }
+
+        return data;
+    }
+
+    TransMult::TransMap TransMult::getTransMap() const {
+        TransMap result;
+        for (std::size_t index = 0; index < m_trans.size(); index++) {
+            if (!m_trans[index].empty())
+                result.emplace(directionFromIndex(index), m_trans[index]);
         }
+        return result;
+    }
+
+    void TransMult::setTransMap(const TransMap& trans) {
+        for (auto& data : m_trans)
+            data.clear();
 
-        return m_trans.at( faceDir );
+        for (const auto& [faceDir, data] : trans)
+            m_trans[directionIndex(faceDir)] = data;
     }
 
     void TransMult::applyMULT(const std::vector<double>& srcData, FaceDir::DirEnum faceDir)
@@ -0,0 +1,203 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/EclipseState/StateSnapshot.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/BinarySerializer.hpp>
+#include <opm/common/utility/MappedFile.hpp>
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char snapshot_magic[8] = {'O', 'P', 'M', 'S', 'N', 'A', 'P', '\0'};
+
+// Must be incremented when the serialized layout of any of the input
+// objects changes.
+constexpr std::uint32_t snapshot_version = 2;
+
+struct SnapshotHeader {
+    std::array<char, sizeof snapshot_magic> magic{};
+    std::uint32_t version = 0;
+    std::size_t fingerprint = 0;
+    std::vector<Opm::InputFileStamp> files;
+    std::size_t payload_size = 0;
+    std::size_t checksum = 0;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(magic);
+        serializer(version);
+        serializer(fingerprint);
+        serializer.vector(files);
+        serializer(payload_size);
+        serializer(checksum);
+    }
+};
+
+std::size_t checksum(const char* data, std::size_t size) {
+    return std::hash<std::string_view>{}(std::string_view{data, size});
+}
+
+// The input objects depend on the library build and on the keyword
+// definitions the deck was parsed with; a snapshot written by a different
+// build is rejected even if the format version is unchanged.
+std::size_t build_fingerprint() {
+    static const std::size_t fingerprint = Opm::Parser{}.keywordFingerprint();
+    return fingerprint;
+}
+
+}
+
+namespace Opm {
+
+void StateSnapshot::save(const fs::path& fname,
+                         const Deck& deck,
+                         const EclipseState& eclipse_state,
+                         const Schedule& schedule,
+                         const SummaryConfig& summary_config)
+{
+    std::vector<char> payload;
+    {
+        BinarySerializer serializer(payload);
+        eclipse_state.serializeFull(serializer);
+        serializer(schedule);
+        serializer(summary_config);
+    }
+
+    SnapshotHeader header;
+    std::copy(std::begin(snapshot_magic), std::end(snapshot_magic), header.magic.begin());
+    header.version = snapshot_version;
+    header.fingerprint = build_fingerprint();
+    for (const auto& input_file : deck.tree().files())
+        header.files.push_back(InputFileStamp::make(input_file));
+    header.payload_size = payload.size();
+    header.checksum = checksum(payload.data(), payload.size());
+
+    std::vector<char> image;
+    BinarySerializer serializer(image);
+    header.serializeOp(serializer);
+
+    const auto tmp_file = fs::path(fname).concat(fmt::format(".{:08x}", std::random_device{}()));
+    try {
+        {
+            std::ofstream stream(tmp_file, std::ios::binary | std::ios::trunc);
+            if (!stream.write(image.data(), image.size()).write(payload.data(), payload.size()).flush())
+                throw std::runtime_error(fmt::format("Writing state snapshot {} failed", fname.string()));
+        }
+        fs::rename(tmp_file, fname);
+    } catch (...) {
+        std::error_code ec;
+        fs::remove(tmp_file, ec);
+        throw;
+    }
+}
+
+
+std::optional<StateSnapshot> StateSnapshot::load(const fs::path& fname,
+                                                 std::shared_ptr<const Python> python)
+{
+    if (!fs::is_regular_file(fname))
+        return std::nullopt;
+
+    try {
+        MappedFile image(fname.string(), MappedFile::Access::Sequential);
+        BinarySerializer serializer(image.data(), image.size());
+
+        SnapshotHeader header;
+        serializer(header.magic);
+        serializer(header.version);
+        if (std::memcmp(header.magic.data(), snapshot_magic, sizeof snapshot_magic) != 0) {
+            OpmLog::warning(fmt::format("Ignoring state snapshot {}: not a snapshot file", fname.string()));
+            return std::nullopt;
+        }
+
+        if (header.version != snapshot_version) {
+            OpmLog::info(fmt::format("Ignoring state snapshot {}: format version {} - expected {}",
+                                     fname.string(), header.version, snapshot_version));
+            return std::nullopt;
+        }
+
+        serializer(header.fingerprint);
+        if (header.fingerprint != build_fingerprint()) {
+            OpmLog::info(fmt::format("Ignoring state snapshot {}: written by a different build of opm-common",
+                                     fname.string()));
+            return std::nullopt;
+        }
+
+        serializer.vector(header.files);
+        serializer(header.payload_size);
+        serializer(header.checksum);
+        for (const auto& input_file : header.files) {
+            if (!input_file.current()) {
+                OpmLog::info(fmt::format("Ignoring state snapshot {}: input file {} has been modified",
+                                         fname.string(), input_file.fname));
+                return std::nullopt;
+            }
+        }
+
+        const char* payload = image.data() + (image.size() - serializer.remaining());
+        if (serializer.remaining() != header.payload_size ||
+            checksum(payload, header.payload_size) != header.checksum) {
+            OpmLog::warning(fmt::format("Ignoring state snapshot {}: checksum mismatch", fname.string()));
+            return std::nullopt;
+        }
+
+        StateSnapshot snapshot;
+        snapshot.eclipse_state = std::make_shared<EclipseState>();
+        snapshot.schedule = std::make_shared<Schedule>(python);
+        snapshot.summary_config = std::make_shared<SummaryConfig>();
+
+        snapshot.eclipse_state->serializeFull(serializer);
+        serializer(*snapshot.schedule);
+        serializer(*snapshot.summary_config);
+        if (serializer.remaining() != 0)
+            throw std::runtime_error("trailing data");
+
+        OpmLog::info(fmt::format("Loaded input state from snapshot {}", fname.string()));
+        return snapshot;
+    } catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Ignoring invalid state snapshot {}: {}", fname.string(), e.what()));
+        return std::nullopt;
+    }
+}
+
+}
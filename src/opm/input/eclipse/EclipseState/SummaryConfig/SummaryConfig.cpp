@@ -1632,17 +1632,19 @@ const SummaryConfigNode& SummaryConfig::operator[](std::size_t index) const {
 
 
 bool SummaryConfig::match(const std::string& keywordPattern) const {
+    const ShellPattern pattern(keywordPattern);
     for (const auto& keyword : this->short_keywords) {
-        if (shmatch(keywordPattern, keyword))
+        if (pattern.match(keyword))
             return true;
     }
     return false;
 }
 
 SummaryConfig::keyword_list SummaryConfig::keywords(const std::string& keywordPattern) const {
+    const ShellPattern pattern(keywordPattern);
     keyword_list kw_list;
     for (const auto& keyword : this->m_keywords) {
-        if (shmatch(keywordPattern, keyword.keyword()))
+        if (pattern.match(keyword.keyword()))
             kw_list.push_back(keyword);
     }
     return kw_list;
@@ -0,0 +1,175 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/BinarySerializer.hpp>
+#include <opm/common/utility/MappedFile.hpp>
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char cache_magic[8] = {'O', 'P', 'M', 'D', 'E', 'C', 'K', '\0'};
+
+// Must be incremented when the serialized layout of the Deck changes.
+constexpr std::uint32_t cache_version = 1;
+
+struct CacheHeader {
+    std::array<char, sizeof cache_magic> magic{};
+    std::uint32_t version = 0;
+    std::size_t fingerprint = 0;
+    std::string data_file;
+    std::vector<Opm::InputFileStamp> files;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(magic);
+        serializer(version);
+        serializer(fingerprint);
+        serializer(data_file);
+        serializer.vector(files);
+    }
+};
+
+}
+
+namespace Opm {
+
+InputFileStamp InputFileStamp::make(const std::string& fname) {
+    // The content is hashed the same way as opmhash hashes keywords.
+    MappedFile file(fname, MappedFile::Access::Sequential);
+    return { fname, file.size(), std::hash<std::string_view>{}(std::string_view{file.data(), file.size()}) };
+}
+
+
+bool InputFileStamp::current() const {
+    std::error_code ec;
+    const auto file_size = fs::file_size(this->fname, ec);
+    if (ec || file_size != this->size)
+        return false;
+
+    return make(this->fname).hash == this->hash;
+}
+
+
+DeckCache::DeckCache(const fs::path& directory, std::size_t fingerprint)
+    : m_directory(directory)
+    , m_fingerprint(fingerprint)
+{}
+
+
+fs::path DeckCache::cacheFile(const std::string& data_file) const {
+    const auto key = fmt::format("{}:{}:{}", fs::weakly_canonical(data_file).string(), data_file, this->m_fingerprint);
+    return this->m_directory / fmt::format("{:016x}.DECKCACHE", std::hash<std::string>{}(key));
+}
+
+
+std::optional<Deck> DeckCache::load(const std::string& data_file) const {
+    const auto cache_file = this->cacheFile(data_file);
+    if (!fs::is_regular_file(cache_file))
+        return std::nullopt;
+
+    try {
+        MappedFile image(cache_file.string(), MappedFile::Access::Sequential);
+        BinarySerializer serializer(image.data(), image.size());
+
+        CacheHeader header;
+        serializer(header.magic);
+        serializer(header.version);
+        serializer(header.fingerprint);
+        if (std::memcmp(header.magic.data(), cache_magic, sizeof cache_magic) != 0 ||
+            header.version != cache_version ||
+            header.fingerprint != this->m_fingerprint)
+            return std::nullopt;
+
+        serializer(header.data_file);
+        serializer.vector(header.files);
+        if (header.data_file != data_file)
+            return std::nullopt;
+
+        for (const auto& file : header.files) {
+            if (!file.current())
+                return std::nullopt;
+        }
+
+        Deck deck;
+        deck.serializeOp(serializer);
+        deck.tree().serializeOp(serializer);
+
+        OpmLog::info(fmt::format("Loaded deck {} from cache {}", data_file, cache_file.string()));
+        return deck;
+    } catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Ignoring invalid deck cache {}: {}", cache_file.string(), e.what()));
+        return std::nullopt;
+    }
+}
+
+
+void DeckCache::store(const std::string& data_file, const Deck& deck) const {
+    const auto cache_file = this->cacheFile(data_file);
+    const auto tmp_file = fs::path(cache_file).concat(fmt::format(".{:08x}", std::random_device{}()));
+
+    try {
+        fs::create_directories(this->m_directory);
+
+        CacheHeader header;
+        std::copy(std::begin(cache_magic), std::end(cache_magic), header.magic.begin());
+        header.version = cache_version;
+        header.fingerprint = this->m_fingerprint;
+        header.data_file = data_file;
+        for (const auto& fname : deck.tree().files())
+            header.files.push_back(InputFileStamp::make(fname));
+
+        std::vector<char> image;
+        BinarySerializer serializer(image);
+        header.serializeOp(serializer);
+        serializer(deck);
+        serializer(deck.tree());
+
+        {
+            std::ofstream stream(tmp_file, std::ios::binary | std::ios::trunc);
+            if (!stream.write(image.data(), image.size()).flush())
+                throw std::runtime_error("Writing deck cache failed");
+        }
+
+        fs::rename(tmp_file, cache_file);
+    } catch (const std::exception& e) {
+        std::error_code ec;
+        fs::remove(tmp_file, ec);
+        OpmLog::warning(fmt::format("Could not store deck {} in cache {}: {}", data_file, cache_file.string(), e.what()));
+    }
+}
+
+}
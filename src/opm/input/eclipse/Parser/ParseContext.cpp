@@ -273,9 +273,10 @@ namespace Opm {
 
 
     void ParseContext::patternUpdate( const std::string& pattern , InputError::Action action) {
+        const ShellPattern shell_pattern(pattern);
         for (const auto& pair : m_errorContexts) {
             const std::string& key = pair.first;
-            if (shmatch( pattern , key))
+            if (shell_pattern.match(key))
                 updateKey( key , action );
          }
     }
@@ -18,14 +18,19 @@
  */
 
 #include <cctype>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <optional>
+#include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <algorithm>
@@ -47,6 +52,7 @@
 #include <opm/input/eclipse/Deck/DeckSection.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/I.hpp>
@@ -62,6 +68,8 @@
 #include "raw/RawKeyword.hpp"
 #include "raw/StarToken.hpp"
 
+#include "project-version.h"
+
 namespace Opm {
 
 namespace {
@@ -914,7 +922,10 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 
             if (str::isTerminatedRecordString(record_buffer)) {
                 std::size_t size = std::distance(record_buffer.begin(), record_buffer.end()) - 1;
-                RawRecord record( std::string_view{ record_buffer.begin(), size }, rawKeyword->location());
+                std::string_view record_string{ record_buffer.begin(), size };
+                auto record = parserKeyword->isDataKeyword()
+                    ? RawRecord::dataRecord( record_string, rawKeyword->location() )
+                    : RawRecord( record_string, rawKeyword->location() );
                 if (rawKeyword->addRecord(record))
                     return rawKeyword;
 
@@ -945,6 +956,174 @@ std::string_view advance_parser_state( ParserState& parserState, const std::stri
     return line;
 }
 
+/*
+  Large data keywords like ZCORN, COORD and PERMX can be converted to
+  DeckKeyword instances on separate threads while the main thread continues
+  to read keywords and include files. The DeferredKeywords class holds the
+  keywords which have been submitted for conversion, in input order, and
+  adds them to the deck when the conversion is complete. Keywords which are
+  not deferred are only added to the deck after all pending keywords.
+
+  The conversion uses private copies of the unit systems and a parse context
+  where all errors are ignored. When the keyword is added to the deck the
+  dimensions are registered with the unit systems of the deck, and recorded
+  errors are passed on to the real parse context, i.e. both the resulting
+  deck and the error handling is identical to a serial parse.
+*/
+
+class DeferredKeywords {
+public:
+    DeferredKeywords(std::size_t threads, const ParseContext& parseContext);
+
+    bool accepts(const ParserKeyword& parserKeyword, const RawKeyword& rawKeyword) const;
+    void push(std::unique_ptr<RawKeyword> rawKeyword, const ParserKeyword& parserKeyword, ParserState& parserState);
+    void flush(ParserState& parserState);
+    std::size_t size() const { return this->entries.size(); }
+
+private:
+    struct Entry {
+        std::unique_ptr<RawKeyword> rawKeyword;
+        const ParserKeyword* parserKeyword;
+        UnitSystem* active_unitsystem;
+        UnitSystem* default_unitsystem;
+        std::unique_ptr<ErrorGuard> errors;
+        std::future<DeckKeyword> keyword;
+    };
+
+    // Smallest size (in characters) of a data keyword to be converted in parallel.
+    static constexpr std::size_t min_size = 65536;
+
+    std::size_t max_pending;
+    ParseContext ignore_context;
+    std::deque<Entry> entries;
+
+    void addFront(ParserState& parserState);
+};
+
+
+[[noreturn]] void throwInputError(const std::exception& e, const KeywordLocation& location) {
+    /*
+      This catch-all of parsing errors is to be able to write a good
+      error message; the parser is quite confused at this state and
+      we should not be tempted to continue the parsing.
+
+      We log a error message with the name of the problematic
+      keyword and the location in the input deck. We rethrow the
+      same exception without updating the what() message of the
+      exception.
+    */
+    const OpmInputError opm_error { e, location } ;
+
+    OpmLog::error(opm_error.what());
+
+    std::throw_with_nested(opm_error);
+}
+
+
+DeferredKeywords::DeferredKeywords(std::size_t threads, const ParseContext& parseContext) :
+    max_pending(threads),
+    ignore_context(parseContext)
+{
+    this->ignore_context.update(InputError::IGNORE);
+}
+
+
+bool DeferredKeywords::accepts(const ParserKeyword& parserKeyword, const RawKeyword& rawKeyword) const {
+    if (this->max_pending < 2)
+        return false;
+
+    if (!parserKeyword.isDataKeyword())
+        return false;
+
+    std::size_t size = 0;
+    for (const auto& record : rawKeyword)
+        size += record.string_size();
+
+    return size >= min_size;
+}
+
+
+void DeferredKeywords::push(std::unique_ptr<RawKeyword> rawKeyword, const ParserKeyword& parserKeyword, ParserState& parserState) {
+    if (this->entries.size() >= this->max_pending)
+        this->addFront(parserState);
+
+    auto& active_unitsystem = parserState.deck.getActiveUnitSystem();
+    auto& default_unitsystem = parserState.deck.getDefaultUnitSystem();
+    auto errors = std::make_unique<ErrorGuard>();
+
+    auto task = [raw = rawKeyword.get(),
+                 kw = &parserKeyword,
+                 context = &this->ignore_context,
+                 guard = errors.get(),
+                 active = active_unitsystem,
+                 default_units = default_unitsystem]() mutable
+    {
+        return kw->parse(*context, *guard, *raw, active, default_units);
+    };
+
+    auto keyword = std::async(std::launch::async, std::move(task));
+    this->entries.push_back({ std::move(rawKeyword), &parserKeyword, &active_unitsystem, &default_unitsystem, std::move(errors), std::move(keyword) });
+}
+
+
+void DeferredKeywords::flush(ParserState& parserState) {
+    while (!this->entries.empty())
+        this->addFront(parserState);
+}
+
+
+void DeferredKeywords::addFront(ParserState& parserState) {
+    auto entry = std::move(this->entries.front());
+    this->entries.pop_front();
+
+    std::optional<DeckKeyword> deck_keyword;
+    std::exception_ptr error;
+    try {
+        deck_keyword.emplace(entry.keyword.get());
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    try {
+        // The messages have already been formatted with the keyword location.
+        for (const auto& [key, msg] : entry.errors->warnings()) {
+            std::string msg_fmt;
+            for (const auto c : msg) {
+                msg_fmt += c;
+                if (c == '{' || c == '}')
+                    msg_fmt += c;
+            }
+
+            parserState.parseContext.handleError(key, msg_fmt, entry.rawKeyword->location(), parserState.errors);
+        }
+        entry.errors->clear();
+
+        if (error)
+            std::rethrow_exception(error);
+
+        // Register the dimensions with the deck unit systems, exactly as
+        // ParserItem::scan() does in a serial parse.
+        for (std::size_t record_nr = 0; record_nr < entry.rawKeyword->size(); record_nr++) {
+            for (const auto& item : entry.parserKeyword->getRecord(record_nr)) {
+                if (item.dataType() != type_tag::fdouble && item.dataType() != type_tag::uda)
+                    continue;
+
+                for (const auto& dim : item.dimensions()) {
+                    entry.active_unitsystem->getNewDimension(dim);
+                    entry.default_unitsystem->getNewDimension(dim);
+                }
+            }
+        }
+
+        parserState.deck.addKeyword( std::move(*deck_keyword) );
+    } catch (const OpmInputError&) {
+        throw;
+    } catch (const std::exception& e) {
+        throwInputError(e, entry.rawKeyword->location());
+    }
+}
+
+
 bool parseState( ParserState& parserState, const Parser& parser ) {
     std::string filename = parserState.current_path().string();
 
@@ -961,8 +1140,16 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     bool ignore_summary = ignore.find(Opm::Ecl::SUMMARY) !=ignore.end()  ? true : false;
     bool ignore_schedule = ignore.find(Opm::Ecl::SCHEDULE) !=ignore.end()  ? true : false;
 
+    DeferredKeywords deferred( parser.threads(), parserState.parseContext );
+
     while( !parserState.done() ) {
-        auto rawKeyword = tryParseKeyword( parserState, parser);
+        std::unique_ptr<RawKeyword> rawKeyword;
+        try {
+            rawKeyword = tryParseKeyword( parserState, parser);
+        } catch (...) {
+            deferred.flush( parserState );
+            throw;
+        }
 
         if( !rawKeyword )
             continue;
@@ -984,11 +1171,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if ((ignore_summary) && (keyw=="SUMMARY"))
             keyw = advance_parser_state( parserState, "SCHEDULE" );
 
-        if ((ignore_schedule) && (keyw=="SCHEDULE"))
+        if ((ignore_schedule) && (keyw=="SCHEDULE")) {
+            deferred.flush( parserState );
             return true;
+        }
 
-        if (rawKeyword->getKeywordName() == Opm::RawConsts::end)
+        if (rawKeyword->getKeywordName() == Opm::RawConsts::end) {
+            deferred.flush( parserState );
             return true;
+        }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::endinclude) {
             parserState.closeFile();
@@ -1023,9 +1214,16 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
             {
                 const auto& location = rawKeyword->location();
-                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
+                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size() + deferred.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
                 OpmLog::info(msg);
             }
+
+            if (deferred.accepts( parserKeyword, *rawKeyword )) {
+                deferred.push( std::move(rawKeyword), parserKeyword, parserState );
+                continue;
+            }
+
+            deferred.flush( parserState );
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
                     if (parserState.python) {
@@ -1046,6 +1244,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                         bool formatted = deck_keyword.getRecord(0).getItem(1).get<std::string>(0)[0] == 'F';
                         const auto& import_file = parserState.getIncludeFilePath(deck_keyword.getRecord(0).getItem(0).get<std::string>(0));
 
+                        // Registered in the DeckTree so that the imported file is
+                        // part of the stamped inputs of a cached deck.
+                        parserState.deck.tree().add_include(std::filesystem::absolute(parserState.current_path()), import_file.value());
                         ImportContainer import(parser, parserState.deck.getActiveUnitSystem(), import_file.value().string(), formatted, parserState.deck.size());
                         for (auto kw : import)
                             parserState.deck.addKeyword(std::move(kw));
@@ -1055,32 +1256,51 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             } catch (const OpmInputError& opm_error) {
                 throw;
             } catch (const std::exception& e) {
-                /*
-                  This catch-all of parsing errors is to be able to write a good
-                  error message; the parser is quite confused at this state and
-                  we should not be tempted to continue the parsing.
-
-                  We log a error message with the name of the problematic
-                  keyword and the location in the input deck. We rethrow the
-                  same exception without updating the what() message of the
-                  exception.
-                */
-                const OpmInputError opm_error { e, rawKeyword->location() } ;
-
-                OpmLog::error(opm_error.what());
-
-                std::throw_with_nested(opm_error);
+                throwInputError(e, rawKeyword->location());
             }
         } else {
+            deferred.flush( parserState );
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
             KeywordLocation location(rawKeyword->getKeywordName(), parserState.current_path().string(), parserState.line());
             OpmLog::warning(Log::fileMessage(location, msg));
         }
     }
 
+    deferred.flush( parserState );
     return true;
 }
 
+std::size_t keyword_fingerprint(const Parser& parser) {
+    auto deck_names = parser.getAllDeckNames();
+    std::sort(deck_names.begin(), deck_names.end());
+
+    std::ostringstream fingerprint;
+    fingerprint << PROJECT_VERSION << ';';
+    // The names of the keywords which are matched by a regular expression
+    // are not deck names themselves, only those names are recorded.
+    for (const auto& name : deck_names) {
+        if (parser.hasKeyword(name))
+            fingerprint << name << '=' << parser.getKeyword(name) << ';';
+        else
+            fingerprint << name << ';';
+    }
+
+    return std::hash<std::string>{}(fingerprint.str());
+}
+
+/*
+  The parsed deck depends on the parser and on the error modes of the
+  ParseContext; the fingerprint of these is part of the key of the cached
+  decks.
+*/
+std::size_t deck_cache_fingerprint(const Parser& parser, const ParseContext& parseContext) {
+    std::string fingerprint = std::to_string(parser.keywordFingerprint()) + ';';
+    for (const auto& [key, action] : parseContext)
+        fingerprint += fmt::format("{}={};", key, static_cast<int>(action));
+
+    return std::hash<std::string>{}(fingerprint);
+}
+
 }
 
 
@@ -1097,8 +1317,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the build
         // system.
 
-        if (addDefault)
+        if (addDefault) {
             this->addDefaultKeywords();
+            this->m_default_keywords = true;
+        }
     }
 
 
@@ -1188,8 +1410,25 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         else
             data_file = std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
 
+        std::optional<DeckCache> deck_cache;
+        if (this->m_deck_cache.has_value() && ignore_sections.empty()) {
+            deck_cache.emplace(this->m_deck_cache.value(), deck_cache_fingerprint(*this, parseContext));
+            auto deck = deck_cache->load(data_file);
+            if (deck.has_value())
+                return std::move(deck.value());
+        }
+
+        const auto num_warnings = errors.warnings().size();
+        const auto has_errors = static_cast<bool>(errors);
+
         ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
         parseState( parserState, *this );
+
+        // Decks which have been parsed with errors or warnings are not
+        // cached, the messages would be lost when the deck is loaded.
+        if (deck_cache.has_value() && !has_errors && !errors && errors.warnings().size() == num_warnings)
+            deck_cache->store(data_file, parserState.deck);
+
         return std::move( parserState.deck );
     }
 
@@ -1231,6 +1470,32 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    void Parser::setThreads(std::size_t threads) {
+        this->m_threads = threads;
+    }
+
+    void Parser::setDeckCache(const std::filesystem::path& directory) {
+        this->m_deck_cache = directory;
+    }
+
+    std::size_t Parser::keywordFingerprint() const {
+        // All parsers with only the default keywords share one fingerprint,
+        // which is computed once.
+        if (this->m_default_keywords) {
+            static const std::size_t fingerprint = keyword_fingerprint(*this);
+            return fingerprint;
+        }
+
+        return keyword_fingerprint(*this);
+    }
+
+    std::size_t Parser::threads() const {
+        if (this->m_threads == 0)
+            return std::max(1U, std::thread::hardware_concurrency());
+
+        return this->m_threads;
+    }
+
     size_t Parser::size() const {
         return m_deckParserKeywords.size();
     }
@@ -1275,6 +1540,7 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
      *   same sweep.
      */
 
+    this->m_default_keywords = false;
     this->keyword_storage.push_back( std::move( parserKeyword ) );
     const ParserKeyword * ptr = std::addressof(this->keyword_storage.back());
     std::string_view name( ptr->getName() );
@@ -462,7 +462,7 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
     if( parser_item.sizeType() == ParserItem::item_size::ALL ) {
         if (parse_raw) {
             deck_item.reserve_additionalRawString(record.size());
-            while (record.size()) {
+            while (!record.empty()) {
                 auto token = record.pop_front();
                 auto raw_string = RawString{ std::string(token) };
                 deck_item.push_back( raw_string );
@@ -470,36 +470,36 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
-        while( record.size() > 0 ) {
+        while( !record.empty() ) {
             auto token = record.pop_front();
 
-            std::string countString;
-            std::string valueString;
+            std::string_view countString;
+            std::string_view valueString;
 
             if( !isStarToken( token, countString, valueString ) ) {
                 deck_item.push_back( readValueToken< T >( token ) );
                 continue;
             }
 
-            StarToken st(token, countString, valueString);
+            const auto count = starTokenCount(token, countString, valueString);
 
-            if( st.hasValue() ) {
-                deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
+            if( !valueString.empty() ) {
+                deck_item.push_back( readValueToken< T >( valueString ), count );
                 continue;
             }
 
             if (parser_item.hasDefault()) {
                 auto value = parser_item.getDefault< T >();
-                deck_item.push_backDefault( value, st.count());
+                deck_item.push_backDefault( value, count);
             } else {
-                deck_item.push_backDummyDefault<T>(st.count());
+                deck_item.push_backDummyDefault<T>(count);
             }
         }
 
         return;
     }
 
-    if( record.size() == 0 ) {
+    if( record.empty() ) {
         // if the record was ended prematurely,
         if( parser_item.hasDefault() ) {
             // use the default value for the item, if there is one...
@@ -523,34 +523,32 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
     // The '*' should be interpreted as a repetition indicator, but it must
     // be preceeded by an integer...
     auto token = record.pop_front();
-    std::string countString;
-    std::string valueString;
+    std::string_view countString;
+    std::string_view valueString;
     if( !isStarToken(token, countString, valueString) ) {
         deck_item.push_back( readValueToken<T>( token) );
         return;
     }
 
-    StarToken st(token, countString, valueString);
+    const auto count = starTokenCount(token, countString, valueString);
 
-    if( st.hasValue() )
-        deck_item.push_back(readValueToken< T >( st.valueString()) );
+    if( !valueString.empty() )
+        deck_item.push_back(readValueToken< T >( valueString ) );
     else if( parser_item.hasDefault() )
         deck_item.push_backDefault( parser_item.getDefault< T >() );
     else
         deck_item.push_backDummyDefault<T>();
 
-    const auto value_start = token.size() - valueString.size();
-    const std::size_t size = token.end() - (token.begin() + value_start);
     // replace the first occurence of "N*FOO" by a sequence of N-1 times
     // "FOO". this is slightly hacky, but it makes it work if the
     // number of defaults pass item boundaries...
     // We can safely make a std::string_view of one_star because it
     // has static storage
     static const char* one_star = "1*";
-    std::string_view rep = !st.hasValue()
+    std::string_view rep = valueString.empty()
                     ? std::string_view{ one_star }
-                    : std::string_view{ token.begin() + value_start, size };
-    record.push_front(rep, st.count() - 1);
+                    : valueString;
+    record.push_front(rep, count - 1);
 
     return;
 }
@@ -702,6 +700,14 @@ std::ostream& operator<<( std::ostream& stream, const ParserItem& item ) {
                 stream << "'" << item.getDefault< std::string >() << "'";
                 break;
 
+            case type_tag::uda:
+                stream << item.getDefault< UDAValue >();
+                break;
+
+            case type_tag::raw_string:
+                stream << "'" << item.getDefault< RawString >() << "'";
+                break;
+
             default:
                 throw std::logic_error( "Item of unknown type." );
         }
@@ -127,7 +127,7 @@ namespace {
         for( const auto& parserItem : *this )
             items.emplace_back( parserItem.scan( rawRecord, active_unitsystem, default_unitsystem ) );
 
-        if (rawRecord.size() > 0) {
+        if (!rawRecord.empty()) {
             std::string msg_format = fmt::format("Record contains too many items in keyword {{0}}. Expected {} items, found {}.\n", this->size(), rawRecord.max_size()) +
                                                  "In file {1} at line {2}.\n" +
                                      fmt::format("Record is \"{}\".", rawRecord.getRecordString());
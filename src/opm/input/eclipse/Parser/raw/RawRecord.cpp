@@ -38,29 +38,30 @@ namespace Opm {
 
 namespace {
 
-std::deque< std::string_view > splitSingleRecordString( const std::string_view& record ) {
-    auto first_nonspace = []( std::string_view::const_iterator begin,
-                              std::string_view::const_iterator end ) {
-        return std::find_if_not( begin, end, RawConsts::is_separator() );
-    };
+std::string_view skip_separators( const std::string_view& input ) {
+    auto first_nonspace = std::find_if_not( input.begin(), input.end(), RawConsts::is_separator() );
+    std::size_t size = std::distance(first_nonspace, input.end());
+    return { first_nonspace, size };
+}
 
-    std::deque< std::string_view > dst;
-    auto current = record.begin();
-    while( (current = first_nonspace( current, record.end() )) != record.end() )
-    {
-        if( *current == RawConsts::quote ) {
-            auto quote_end = std::find( current + 1, record.end(), RawConsts::quote ) + 1;
-            std::size_t size = std::distance(current, quote_end);
-            dst.push_back( { current, size} );
-            current = quote_end;
-        } else {
-            auto token_end = std::find_if( current, record.end(), RawConsts::is_separator() );
-            std::size_t size = std::distance(current, token_end);
-            dst.push_back( { current, size } );
-            current = token_end;
-        }
+std::size_t count_tokens( std::string_view input ) {
+    std::size_t count = 0;
+    input = skip_separators( input );
+    while (!input.empty()) {
+        RawRecord::next_token( input );
+        count++;
     }
 
+    return count;
+}
+
+std::deque< std::string_view > splitSingleRecordString( std::string_view record ) {
+    std::deque< std::string_view > dst;
+
+    record = skip_separators( record );
+    while (!record.empty())
+        dst.push_back( RawRecord::next_token( record ) );
+
     return dst;
 }
 
@@ -81,27 +82,71 @@ inline bool even_quotes( const T& str ) {
 
 }
 
-    RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location, bool text) :
+    RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location, bool text, bool split) :
         m_sanitizedRecordString( singleRecordString )
     {
 
         if (text)
             this->m_recordItems.push_back(this->m_sanitizedRecordString);
         else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
             if( !even_quotes( singleRecordString ) ) {
                 std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
                 throw OpmInputError(error, location);
             }
+
+            if (split)
+                this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
+            else {
+                this->m_unsplit = skip_separators( m_sanitizedRecordString );
+                this->m_unsplit_size = count_tokens( this->m_unsplit );
+            }
         }
-        this->m_max_size = this->m_recordItems.size();
+        this->m_max_size = this->m_recordItems.size() + this->m_unsplit_size;
     }
 
+    RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location, bool text) :
+        RawRecord(singleRecordString, location, text, true)
+    {}
+
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location) :
-        RawRecord(singleRecordString, location, false)
+        RawRecord(singleRecordString, location, false, true)
     {}
 
+    RawRecord RawRecord::dataRecord(const std::string_view& singleRecordString, const KeywordLocation& location) {
+        return RawRecord(singleRecordString, location, false, false);
+    }
+
+    std::string_view RawRecord::next_token( std::string_view& input ) {
+        auto current = input.begin();
+        auto token_end = (*current == RawConsts::quote)
+            ? std::find( current + 1, input.end(), RawConsts::quote ) + 1
+            : std::find_if( current, input.end(), RawConsts::is_separator() );
+
+        std::size_t size = std::distance(current, token_end);
+        std::string_view token{ current, size };
+
+        input = skip_separators( { token_end, static_cast<std::size_t>(std::distance(token_end, input.end())) } );
+        return token;
+    }
+
+    size_t RawRecord::size() const {
+        return this->m_recordItems.size() + this->m_unsplit_size;
+    }
+
+    std::string_view RawRecord::getItem(size_t index) const {
+        if (index < this->m_recordItems.size())
+            return this->m_recordItems[index];
+
+        auto unsplit = this->m_unsplit;
+        for (auto remaining = index - this->m_recordItems.size(); !unsplit.empty(); remaining--) {
+            auto token = next_token( unsplit );
+            if (remaining == 0)
+                return token;
+        }
+
+        throw std::out_of_range("Index " + std::to_string(index) + " out of range in record");
+    }
+
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
         this->m_max_size += count;
@@ -38,18 +38,35 @@ class KeywordLocation;
         RawRecord( const std::string_view&, const KeywordLocation&, bool text);
         explicit RawRecord( const std::string_view&, const KeywordLocation&);
 
+        // The record of a data keyword like ZCORN or PERMX can hold millions
+        // of tokens. Such records are not split in tokens up front, instead
+        // the tokens are extracted from the record string when consumed with
+        // pop_front(). The number of tokens is counted when the record is
+        // created.
+        static RawRecord dataRecord( const std::string_view&, const KeywordLocation& );
+
         inline std::string_view pop_front();
         inline std::string_view front() const;
         void push_front( std::string_view token, std::size_t count );
-        inline size_t size() const;
+        inline bool empty() const;
+        size_t size() const;
         std::size_t max_size() const;
 
         std::string getRecordString() const;
-        inline std::string_view getItem(size_t index) const;
+        std::size_t string_size() const { return m_sanitizedRecordString.size(); }
+        std::string_view getItem(size_t index) const;
+
+        // Extract the first token from input and advance input to the start
+        // of the next token; input must start with a token.
+        static std::string_view next_token( std::string_view& input );
 
     private:
+        RawRecord( const std::string_view&, const KeywordLocation&, bool text, bool split);
+
         std::string_view m_sanitizedRecordString;
         std::deque< std::string_view > m_recordItems;
+        std::string_view m_unsplit;
+        std::size_t m_unsplit_size = 0;
         std::size_t m_max_size;
     };
 
@@ -58,21 +75,27 @@ class KeywordLocation;
      * inlining the calls gives a decent low-effort performance benefit.
      */
     std::string_view RawRecord::pop_front() {
+        if (this->m_recordItems.empty()) {
+            this->m_unsplit_size--;
+            return next_token(this->m_unsplit);
+        }
+
         auto front = m_recordItems.front();
         this->m_recordItems.pop_front();
         return front;
     }
 
     std::string_view RawRecord::front() const {
-        return this->m_recordItems.front();
-    }
+        if (this->m_recordItems.empty()) {
+            auto unsplit = this->m_unsplit;
+            return next_token(unsplit);
+        }
 
-    size_t RawRecord::size() const {
-        return m_recordItems.size();
+        return this->m_recordItems.front();
     }
 
-    std::string_view RawRecord::getItem(size_t index) const {
-        return this->m_recordItems.at( index );
+    bool RawRecord::empty() const {
+        return this->m_recordItems.empty() && this->m_unsplit.empty();
     }
 }
 
@@ -20,89 +20,171 @@
 #include <array>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
 
+#if !defined(__cpp_lib_to_chars)
 #include <boost/spirit/include/qi.hpp>
+#endif
 
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 
 #include "StarToken.hpp"
 
-namespace qi = boost::spirit::qi;
+namespace {
+
+    // std::from_chars() does not accept a leading '+'; strip it here, but
+    // leave constructs like "+-1" for from_chars() to reject.
+    std::string_view strip_plus(std::string_view view) {
+        if (view.size() > 1 && view[0] == '+' && view[1] != '+' && view[1] != '-')
+            view.remove_prefix(1);
+
+        return view;
+    }
+
+#if defined(__cpp_lib_to_chars)
+
+    bool from_chars_double(std::string_view view, double& value) {
+        const auto* first = view.data();
+        const auto* last = first + view.size();
+        const auto result = std::from_chars(first, last, value);
+        return (result.ec == std::errc{}) && (result.ptr == last);
+    }
+
+    // Eclipse supports Fortran syntax for specifying exponents of floating
+    // point numbers ('D' and 'E', e.g., 1.234d5); the 'D' form is rare and
+    // is handled by converting a copy of the token.
+    bool parse_double(std::string_view view, double& value) {
+        view = strip_plus(view);
+
+        const auto exp_pos = view.find_first_of("dD");
+        if (exp_pos == std::string_view::npos)
+            return from_chars_double(view, value);
+
+        std::string copy(view);
+        copy[exp_pos] = 'E';
+        return from_chars_double(copy, value);
+    }
+
+#else
+
+    namespace qi = boost::spirit::qi;
+
+    template< typename T >
+    struct fortran_double : qi::real_policies< T > {
+        // Eclipse supports Fortran syntax for specifying exponents of floating point
+        // numbers ('D' and 'E', e.g., 1.234d5)
+        template< typename It >
+        static bool parse_exp( It& first, const It& last ) {
+            if( first == last ||
+                (*first != 'e' && *first != 'E' &&
+                *first != 'd' && *first != 'D' ) )
+                return false;
+            ++first;
+            return true;
+        }
+    };
+
+    bool parse_double(std::string_view view, double& value) {
+        qi::real_parser< double, fortran_double< double > > double_;
+        auto cursor = view.begin();
+        const auto ok = qi::parse( cursor, view.end(), double_, value );
+        return ok && cursor == view.end();
+    }
+
+#endif
+
+}
 
 namespace Opm {
 
     bool isStarToken(const std::string_view& token,
-                           std::string& countString,
-                           std::string& valueString) {
+                     std::string_view& countString,
+                     std::string_view& valueString) {
         // find first character which is not a digit
         size_t pos = 0;
         for (; pos < token.length(); ++pos)
-            if (!std::isdigit(token[pos]))
+            if (!std::isdigit(static_cast<unsigned char>(token[pos])))
                 break;
 
         // if no such character exists or if this character is not a star, the token is
         // not a "star token" (i.e. it is not a "repeat this value N times" token.
         if (pos >= token.size() || token[pos] != '*')
             return false;
+
         // Quote from the Eclipse Reference Manual: "An asterisk by
         // itself is not sufficent". However, our experience is that
         // Eclipse accepts such tokens and we therefore interpret "*"
         // as "1*".
         //
         // Tokens like "*12" are recognized as a star token
-        // here, but we will throw in the code which uses
-        // StarToken<T>. (Because Eclipse does not seem to
-        // accept these and we would stay as closely to the spec as
-        // possible.)
-        else if (pos == 0) {
-            countString = "";
-            valueString = std::string(token.substr(pos + 1));
-            return true;
-        }
+        // here, but we will throw in starTokenCount(). (Because
+        // Eclipse does not seem to accept these and we would stay as
+        // closely to the spec as possible.)
+        //
+        // If a star is prefixed by an unsigned integer N, then this
+        // should be interpreted as "repeat value after star N times"
+        countString = token.substr(0, pos);
+        valueString = token.substr(pos + 1);
+        return true;
+    }
+
+    bool isStarToken(const std::string_view& token,
+                           std::string& countString,
+                           std::string& valueString) {
+        std::string_view count, value;
+        if (!isStarToken(token, count, value))
+            return false;
 
-        // if a star is prefixed by an unsigned integer N, then this should be
-        // interpreted as "repeat value after star N times"
-        countString = std::string(token.substr(0, pos));
-        valueString = std::string(token.substr(pos + 1));
+        countString = std::string(count);
+        valueString = std::string(value);
         return true;
     }
 
+    std::size_t starTokenCount(const std::string_view& token,
+                               const std::string_view& countString,
+                               const std::string_view& valueString) {
+        // special-case the interpretation of a lone star as "1*" but do not
+        // allow constructs like "*123"...
+        if (countString.empty()) {
+            if (!valueString.empty())
+                // TODO: decorate the deck with a warning instead?
+                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + std::string(token) + "\'.");
+
+            // TODO: since this is explicitly forbidden by the documentation it might
+            // be a good idea to decorate the deck with a warning?
+            return 1;
+        }
+
+        int cnt = 0;
+        const auto result = std::from_chars(countString.data(), countString.data() + countString.size(), cnt);
+        if (result.ec == std::errc::result_out_of_range)
+            throw std::out_of_range("Repetition count out of range. Token: \'" + std::string(token) + "\'.");
+
+        if (cnt < 1)
+            // TODO: decorate the deck with a warning instead?
+            throw std::invalid_argument("Specifying zero repetitions is not allowed. Token: \'" + std::string(token) + "\'.");
+
+        return static_cast<std::size_t>(cnt);
+    }
+
     template<>
     int readValueToken< int >( std::string_view view ) {
         int n = 0;
-        auto cursor = view.begin();
-        const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
+        const auto number = strip_plus(view);
+        const auto* last = number.data() + number.size();
+        const auto result = std::from_chars( number.data(), last, n );
 
-        if( ok && cursor == view.end() ) return n;
+        if( result.ec == std::errc{} && result.ptr == last ) return n;
         throw std::invalid_argument( "Malformed integer '" + std::string(view) + "'" );
     }
 
-    template< typename T >
-    struct fortran_double : qi::real_policies< T > {
-        // Eclipse supports Fortran syntax for specifying exponents of floating point
-        // numbers ('D' and 'E', e.g., 1.234d5)
-        template< typename It >
-        static bool parse_exp( It& first, const It& last ) {
-            if( first == last ||
-                (*first != 'e' && *first != 'E' &&
-                *first != 'd' && *first != 'D' ) )
-                return false;
-            ++first;
-            return true;
-        }
-    };
-
     template<>
     double readValueToken< double >( std::string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return n;
+        if( parse_double( view, n ) ) return n;
         throw std::invalid_argument( "Malformed floating point number '" + std::string(view) + "'" );
     }
 
@@ -127,35 +209,12 @@ namespace Opm {
     template<>
     UDAValue readValueToken< UDAValue >( std::string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return UDAValue(n);
+        if( parse_double( view, n ) ) return UDAValue(n);
         return UDAValue( readValueToken<std::string>(view) );
     }
 
     void StarToken::init_( const std::string_view& token ) {
-        // special-case the interpretation of a lone star as "1*" but do not
-        // allow constructs like "*123"...
-        if (m_countString == "") {
-            if (m_valueString != "")
-                // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Not specifying a count also implies not specifying a value. Token: \'" + std::string(token) + "\'.");
-
-            // TODO: since this is explicitly forbidden by the documentation it might
-            // be a good idea to decorate the deck with a warning?
-            m_count = 1;
-        }
-        else {
-            const auto cnt = std::stoi( m_countString );
-
-            if (cnt < 1)
-                // TODO: decorate the deck with a warning instead?
-                throw std::invalid_argument("Specifying zero repetitions is not allowed. Token: \'" + std::string(token) + "\'.");
-
-            m_count = static_cast<std::size_t>(cnt);
-        }
+        m_count = starTokenCount(token, m_countString, m_valueString);
     }
 
 }
@@ -22,6 +22,7 @@
 
 #include <cctype>
 #include <string>
+#include <string_view>
 
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
@@ -30,6 +31,19 @@ namespace Opm {
                            std::string& countString,
                            std::string& valueString);
 
+    // As above, but countString and valueString are views into token; this
+    // variant does not allocate and is used when scanning bulk data.
+    bool isStarToken(const std::string_view& token,
+                     std::string_view& countString,
+                     std::string_view& valueString);
+
+    // The repetition count of a star token which has been split with
+    // isStarToken(); throws std::invalid_argument for the forms which are
+    // not accepted, i.e. "*123" and "0*".
+    std::size_t starTokenCount(const std::string_view& token,
+                               const std::string_view& countString,
+                               const std::string_view& valueString);
+
     template <class T>
     T readValueToken( std::string_view );
 
@@ -120,8 +120,9 @@ Action::Value ASTNode::value(const Action::Context& context) const {
                 const auto& wlm = context.wlist_manager();
                 wnames = wlm.wells(well_arg);
             } else {
+                const ShellPattern pattern(well_arg);
                 for (const auto& well : context.wells(this->func)) {
-                    if (shmatch(well_arg, well))
+                    if (pattern.match(well))
                         wnames.push_back(well);
                 }
             }
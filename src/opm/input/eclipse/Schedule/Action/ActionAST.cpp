@@ -25,6 +25,7 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 
@@ -36,6 +37,7 @@ namespace Action {
 AST::AST(const std::vector<std::string>& tokens) {
     auto condition_node = Action::Parser::parse(tokens);
     this->condition.reset( new Action::ASTNode(condition_node) );
+    this->program = std::make_shared<Action::Program>(*this->condition);
 }
 
 AST AST::serializeObject()
@@ -47,12 +49,26 @@ AST AST::serializeObject()
 }
 
 Action::Result AST::eval(const Action::Context& context) const {
+    if (this->condition)
+        return this->compiled().eval(context);
+    else
+        return Action::Result(false);
+}
+
+Action::Result AST::eval_tree(const Action::Context& context) const {
     if (this->condition)
         return this->condition->eval(context);
     else
         return Action::Result(false);
 }
 
+const Action::Program& AST::compiled() const {
+    if (!this->program)
+        this->program = std::make_shared<Action::Program>(*this->condition);
+
+    return *this->program;
+}
+
 
 bool AST::operator==(const AST& data) const {
     if ((condition && !data.condition) ||
@@ -24,7 +24,7 @@ namespace Opm {
 namespace Action {
 
     void Context::add(const std::string& func, const std::string& arg, double value) {
-        this->values[func + ":" + arg] = value;
+        this->add(func + ":" + arg, value);
     }
 
     Context::Context(const SummaryState& summary_state_arg, const WListManager& wlm_) :
@@ -32,11 +32,12 @@ namespace Action {
         wlm(wlm_)
     {
         for (const auto& pair : TimeService::eclipseMonthIndices())
-            this->add(pair.first, pair.second);
+            this->values[pair.first] = pair.second;
     }
 
     void Context::add(const std::string& func, double value) {
         this->values[func] = value;
+        this->user_values = true;
     }
 
 
@@ -61,5 +62,15 @@ namespace Action {
     const WListManager& Context::wlist_manager() const {
         return this->wlm;
     }
+
+
+    const SummaryState& Context::summary() const {
+        return this->summary_state;
+    }
+
+
+    bool Context::has_user_values() const {
+        return this->user_values;
+    }
 }
 }
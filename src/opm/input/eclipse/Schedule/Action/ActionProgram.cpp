@@ -0,0 +1,433 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/ActionProgram.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+#include <opm/common/utility/TimeService.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Opm {
+namespace Action {
+
+namespace {
+
+bool is_comparison(TokenType op) {
+    switch (op) {
+    case TokenType::op_eq:
+    case TokenType::op_ge:
+    case TokenType::op_le:
+    case TokenType::op_ne:
+    case TokenType::op_gt:
+    case TokenType::op_lt:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool eval_cmp(double lhs, TokenType op, double rhs) {
+    switch (op) {
+    case TokenType::op_eq:
+        return lhs == rhs;
+    case TokenType::op_ge:
+        return lhs >= rhs;
+    case TokenType::op_le:
+        return lhs <= rhs;
+    case TokenType::op_ne:
+        return lhs != rhs;
+    case TokenType::op_gt:
+        return lhs > rhs;
+    case TokenType::op_lt:
+        return lhs < rhs;
+    default:
+        throw std::invalid_argument("Incorrect operator type - expected comparison");
+    }
+}
+
+void set_bit(std::vector<std::uint64_t>& bits, std::size_t index) {
+    const auto word = index / 64;
+    if (bits.size() <= word)
+        bits.resize(word + 1, 0);
+    bits[word] |= std::uint64_t{1} << (index % 64);
+}
+
+bool any_bit(const std::vector<std::uint64_t>& bits) {
+    return std::any_of(bits.begin(), bits.end(), [](std::uint64_t word) { return word != 0; });
+}
+
+}
+
+
+Program::Program(const ASTNode& condition) {
+    this->compile(condition, 0, false);
+
+    std::size_t max_depth = 0;
+    for (const auto& instruction : this->code)
+        max_depth = std::max(max_depth, instruction.depth);
+    this->registers.resize(max_depth + 2);
+}
+
+
+std::size_t Program::size() const {
+    return this->code.size();
+}
+
+
+void Program::compile(const ASTNode& node, std::size_t depth, bool wells_matter) {
+    const auto index = this->code.size();
+    {
+        Instruction instruction;
+        instruction.op = OpCode::Invalid;
+        instruction.end = index + 1;
+        instruction.depth = depth;
+        instruction.wells_matter = wells_matter;
+        this->code.push_back(std::move(instruction));
+    }
+
+    if (node.children.empty()) {
+        this->code[index].node = node;
+        return;
+    }
+
+    if (node.type == TokenType::op_and || node.type == TokenType::op_or) {
+        const bool is_or = node.type == TokenType::op_or;
+        bool has_wells = false;
+        for (const auto& child : node.children) {
+            const auto child_index = this->code.size();
+            this->compile(child, depth + 1, wells_matter || is_or);
+            has_wells = has_wells || this->code[child_index].has_wells;
+        }
+
+        auto& instruction = this->code[index];
+        instruction.op = is_or ? OpCode::Or : OpCode::And;
+        instruction.has_wells = has_wells;
+        instruction.end = this->code.size();
+        return;
+    }
+
+    /*
+      Comparisons which can not be evaluated with the syntax tree are kept as
+      Invalid instructions and evaluated with the tree to get the same error.
+    */
+    auto& instruction = this->code[index];
+    if (node.children.size() != 2 || !is_comparison(node.type)) {
+        instruction.node = node;
+        return;
+    }
+
+    const auto& lhs = node.children[0];
+    const auto& rhs = node.children[1];
+    if (!lhs.children.empty() || !rhs.children.empty()) {
+        instruction.node = node;
+        return;
+    }
+
+    const auto is_pattern = [](const ASTNode& leaf) {
+        return leaf.arg_list.size() == 1 && leaf.arg_list[0].find("*") != std::string::npos;
+    };
+    if ((is_pattern(lhs) && lhs.func_type != FuncType::well) || is_pattern(rhs)) {
+        instruction.node = node;
+        return;
+    }
+
+    instruction.lhs = this->compile_operand(lhs);
+    if (lhs.func_type == FuncType::time_month && rhs.type == TokenType::number) {
+        instruction.rhs.kind = OperandKind::Number;
+        instruction.rhs.number = std::round(rhs.number);
+    } else
+        instruction.rhs = this->compile_operand(rhs);
+
+    if (instruction.rhs.kind != OperandKind::Number && instruction.rhs.kind != OperandKind::Scalar) {
+        instruction.node = node;
+        return;
+    }
+
+    instruction.op = OpCode::Compare;
+    instruction.cmp = node.type;
+    instruction.has_wells = instruction.lhs.kind != OperandKind::Number && instruction.lhs.kind != OperandKind::Scalar;
+}
+
+
+Program::Operand Program::compile_operand(const ASTNode& node) const {
+    Operand operand;
+    if (node.type == TokenType::number) {
+        operand.kind = OperandKind::Number;
+        operand.number = node.number;
+        return operand;
+    }
+
+    operand.func = node.func;
+    if (node.arg_list.empty()) {
+        operand.kind = OperandKind::Scalar;
+        operand.key = node.func;
+
+        const auto& months = TimeService::eclipseMonthIndices();
+        const auto month_iter = months.find(node.func);
+        if (month_iter != months.end())
+            operand.month = month_iter->second;
+
+        return operand;
+    }
+
+    const auto& well_arg = node.arg_list[0];
+    if (node.arg_list.size() == 1 && well_arg.find("*") != std::string::npos) {
+        operand.kind = (well_arg[0] == '*' && well_arg.size() > 1) ? OperandKind::WellList : OperandKind::WellPattern;
+        operand.key = well_arg;
+        return operand;
+    }
+
+    operand.key = node.func;
+    for (const auto& arg : node.arg_list)
+        operand.key += ":" + arg;
+
+    if (node.func_type == FuncType::well) {
+        operand.kind = OperandKind::Well;
+        operand.well = well_arg;
+    } else
+        operand.kind = OperandKind::Scalar;
+
+    return operand;
+}
+
+
+Result Program::eval(const Context& context) const {
+    this->execute(0, context);
+
+    const auto& instruction = this->code.front();
+    const auto& reg = this->registers[instruction.depth];
+    if (!instruction.has_wells)
+        return Result(reg.value);
+
+    std::vector<std::string> wells;
+    for (std::size_t word = 0; word < reg.wells.size(); word++) {
+        const auto bits = reg.wells[word];
+        for (std::size_t bit = 0; bits != 0 && bit < 64; bit++) {
+            if ((bits >> bit) & 1)
+                wells.push_back(this->well_names[word * 64 + bit]);
+        }
+    }
+    return Result(reg.value, wells);
+}
+
+
+std::size_t Program::execute(std::size_t index, const Context& context) const {
+    const auto& instruction = this->code[index];
+    auto& reg = this->registers[instruction.depth];
+
+    if (instruction.op == OpCode::Invalid) {
+        instruction.node->eval(context);
+        throw std::logic_error("Invalid ACTIONX condition evaluated without error");
+    }
+
+    if (instruction.op == OpCode::Compare) {
+        this->compare(instruction, reg, context);
+        return instruction.end;
+    }
+
+    /*
+      The combination of the operands mirrors Result::operator&=() and
+      Result::operator|=(); the operands without wells are skipped when the
+      truth value is settled, and when an AND is false and none of its
+      ancestors is an OR the matching wells can not reach the final result
+      and the remaining operands are skipped as well.
+    */
+    const bool is_and = instruction.op == OpCode::And;
+    const auto& child_reg = this->registers[instruction.depth + 1];
+    bool has_wells = false;
+    reg.value = is_and;
+    reg.wells.clear();
+
+    auto child = index + 1;
+    while (child < instruction.end) {
+        const auto& child_instruction = this->code[child];
+        if (is_and && !reg.value) {
+            if (!instruction.wells_matter)
+                break;
+
+            if (!child_instruction.has_wells || (has_wells && !any_bit(reg.wells))) {
+                child = child_instruction.end;
+                continue;
+            }
+        }
+
+        if (!is_and && reg.value && !child_instruction.has_wells) {
+            child = child_instruction.end;
+            continue;
+        }
+
+        child = this->execute(child, context);
+        if (is_and)
+            reg.value = reg.value && child_reg.value;
+        else
+            reg.value = reg.value || child_reg.value;
+
+        if (!child_instruction.has_wells)
+            continue;
+
+        if (!has_wells) {
+            reg.wells = child_reg.wells;
+            has_wells = true;
+        } else if (is_and) {
+            for (std::size_t word = 0; word < reg.wells.size(); word++)
+                reg.wells[word] &= word < child_reg.wells.size() ? child_reg.wells[word] : 0;
+        } else {
+            if (reg.wells.size() < child_reg.wells.size())
+                reg.wells.resize(child_reg.wells.size(), 0);
+            for (std::size_t word = 0; word < child_reg.wells.size(); word++)
+                reg.wells[word] |= child_reg.wells[word];
+        }
+    }
+
+    return instruction.end;
+}
+
+
+void Program::compare(const Instruction& instruction, Register& reg, const Context& context) const {
+    const auto& lhs = instruction.lhs;
+    reg.wells.clear();
+
+    if (lhs.kind == OperandKind::Number || lhs.kind == OperandKind::Scalar) {
+        const auto lhs_value = this->value(lhs, context);
+        reg.value = eval_cmp(lhs_value, instruction.cmp, this->value(instruction.rhs, context));
+        return;
+    }
+
+    if (lhs.kind == OperandKind::Well) {
+        const auto lhs_value = this->value(lhs, context);
+        reg.value = eval_cmp(lhs_value, instruction.cmp, this->value(instruction.rhs, context));
+        if (reg.value)
+            set_bit(reg.wells, this->well_id(lhs.well));
+        return;
+    }
+
+    this->resolve(lhs, context);
+    const auto rhs_value = this->value(instruction.rhs, context);
+    const auto& st = context.summary();
+
+    reg.value = false;
+    for (std::size_t index = 0; index < lhs.names.size(); index++) {
+        if (lhs.kind == OperandKind::WellPattern) {
+            auto& handle = lhs.handles[index];
+            if (!handle.has_value())
+                handle = st.find_well_var_handle(lhs.names[index], lhs.func);
+
+            if (!handle.has_value() || !st.has(*handle))
+                continue;
+        }
+
+        if (eval_cmp(this->well_value(lhs, index, context), instruction.cmp, rhs_value)) {
+            set_bit(reg.wells, lhs.well_index[index]);
+            reg.value = true;
+        }
+    }
+}
+
+
+double Program::value(const Operand& operand, const Context& context) const {
+    if (operand.kind == OperandKind::Number)
+        return operand.number;
+
+    if (context.has_user_values())
+        return context.get(operand.key);
+
+    if (operand.month.has_value())
+        return *operand.month;
+
+    const auto& st = context.summary();
+    if (operand.layout_id != st.layout_id() || !operand.handle.has_value()) {
+        operand.layout_id = st.layout_id();
+        operand.handle = st.find_handle(operand.key);
+    }
+
+    if (operand.handle.has_value() && st.has(*operand.handle))
+        return st.get(*operand.handle);
+
+    return context.get(operand.key);
+}
+
+
+double Program::well_value(const Operand& operand, std::size_t index, const Context& context) const {
+    const auto& handle = operand.handles[index];
+    if (!context.has_user_values() && handle.has_value() && context.summary().has(*handle))
+        return context.summary().get(*handle);
+
+    return context.get(operand.func, operand.names[index]);
+}
+
+
+/*
+  Resolves the wells of a well pattern or well list to SummaryState handles.
+  The wells matching a pattern are taken from all the wells of the
+  SummaryState, and the wells without a value for the variable are skipped
+  when the program is evaluated. The handles of a well list are kept for as
+  long as the list has the same wells.
+*/
+void Program::resolve(const Operand& operand, const Context& context) const {
+    const auto& st = context.summary();
+    const bool same_layout = operand.layout_id == st.layout_id() && operand.names_version == st.names_version();
+
+    if (operand.kind == OperandKind::WellPattern) {
+        if (same_layout && operand.resolved)
+            return;
+
+        operand.names.clear();
+        const ShellPattern pattern(operand.key);
+        for (const auto& well : st.wells()) {
+            if (pattern.match(well))
+                operand.names.push_back(well);
+        }
+    } else {
+        auto wells = context.wlist_manager().wells(operand.key);
+        if (same_layout && operand.resolved && wells == operand.names)
+            return;
+
+        operand.names = std::move(wells);
+    }
+
+    operand.resolved = true;
+    operand.layout_id = st.layout_id();
+    operand.names_version = st.names_version();
+    operand.well_index.clear();
+    operand.handles.clear();
+    for (const auto& well : operand.names) {
+        operand.well_index.push_back(this->well_id(well));
+        operand.handles.push_back(st.find_well_var_handle(well, operand.func));
+    }
+}
+
+
+std::size_t Program::well_id(const std::string& well) const {
+    const auto iter = this->well_table.find(well);
+    if (iter != this->well_table.end())
+        return iter->second;
+
+    const auto id = this->well_names.size();
+    this->well_table.emplace(well, id);
+    this->well_names.push_back(well);
+    return id;
+}
+
+}
+}
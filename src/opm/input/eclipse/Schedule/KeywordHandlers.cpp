@@ -84,6 +84,7 @@
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
+#include <opm/input/eclipse/Utility/InputProfiler.hpp>
 
 #include "Well/injection.hpp"
 
@@ -2234,6 +2235,7 @@ File {} line {}.)", wname, location.keyword, location.filename, location.lineno)
             return false;
         }
 
+        const auto timer = InputProfiler::time("Schedule", handlerContext.keyword.name());
         try {
             std::invoke(function_iterator->second, this, handlerContext);
         } catch (const OpmInputError&) {
@@ -25,6 +25,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -33,6 +34,7 @@
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/BinarySerializer.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/shmatch.hpp>
@@ -60,6 +62,7 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/MSW/SICD.hpp>
 #include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
 #include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
@@ -69,6 +72,7 @@
 #include <opm/input/eclipse/Schedule/OilVaporizationProperties.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
@@ -87,16 +91,13 @@
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
+#include <opm/input/eclipse/Utility/InputProfiler.hpp>
 
 #include "Well/injection.hpp"
 #include "MSW/Compsegs.hpp"
 
 namespace {
 
-    bool name_match(const std::string& pattern, const std::string& name) {
-        return Opm::shmatch(pattern, name);
-    }
-
     double sumthin_summary_section(const Opm::SUMMARYSection& section) {
         const auto entries = section.getKeywordList<Opm::ParserKeywords::SUMTHIN>();
 
@@ -182,6 +183,8 @@ namespace Opm {
             this->iterateScheduleSection( 0, this->m_sched_deck.size(), parseContext, errors, grid, nullptr, "");
         }
 
+        InputProfiler::recordSchedule(*this);
+
         //m_grid = std::make_shared<SparseScheduleGrid>(grid, gridWrapper.getHitKeys());
     }
     catch (const OpmInputError& opm_error) {
@@ -400,6 +403,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix) {
 
+        this->m_generation++;
+
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
         auto deck_time = [this](double seconds) { return this->m_static.m_unit_system.from_si(UnitSystem::measure::time, seconds); };
@@ -640,6 +645,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
       Well pointer that will go stale and needs to be refreshed.
     */
     bool Schedule::updateWellStatus( const std::string& well_name, std::size_t reportStep , Well::Status status, std::optional<KeywordLocation> location) {
+        this->m_generation++;
         auto well2 = this->snapshots[reportStep].wells.get(well_name);
         if (well2.getConnections().empty() && status == Well::Status::OPEN) {
             if (location) {
@@ -1048,11 +1054,10 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
+            const auto& group_names = group_order.names();
             std::vector<std::string> names;
-            for (const auto& gname : group_order) {
-                if (name_match(pattern, gname))
-                    names.push_back(gname);
-            }
+            for (const auto& index : match_all(pattern, group_names))
+                names.push_back(group_names[index]);
             return names;
         }
 
@@ -1211,6 +1216,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     void Schedule::filterConnections(const ActiveGridCells& grid) {
+        this->m_generation++;
         for (auto& sched_state : this->snapshots) {
             for (auto& well : sched_state.wells()) {
                 well.get().filterConnections(grid);
@@ -1254,6 +1260,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
     void Schedule::applyKeywords(
              std::vector<DeckKeyword*>& keywords, std::size_t reportStep) {
+        this->m_generation++;
         ParseContext parseContext;
         ErrorGuard errors;
         ScheduleGrid grid(this->completed_cells);
@@ -1291,6 +1298,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     SimulatorUpdate Schedule::applyAction(std::size_t reportStep, const time_point&, const Action::ActionX& action, const Action::Result& result, const std::unordered_map<std::string, double>& target_wellpi) {
+        this->m_generation++;
         const std::string prefix = "| ";
         ParseContext parseContext;
         ErrorGuard errors;
@@ -1299,6 +1307,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
         OpmLog::info("/----------------------------------------------------------------------");
         OpmLog::info(fmt::format("{0}Action {1} evaluated to true. Will add action keywords and\n{0}rerun Schedule section.\n{0}", prefix, action.name()));
+        const auto before_action = this->snapshots[reportStep];
+        std::vector<ScheduleState> previous(std::make_move_iterator(this->snapshots.begin() + reportStep + 1),
+                                            std::make_move_iterator(this->snapshots.end()));
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck[reportStep];
         for (const auto& keyword : action) {
@@ -1323,8 +1334,15 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 this->snapshots.back().wellgroup_events().addEvent(well, ScheduleEvents::ACTIONX_WELL_EVENT);
         }
 
-        if (reportStep < this->m_sched_deck.size() - 1)
-            iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(), parseContext, errors, grid, &target_wellpi, prefix);
+        if (reportStep < this->m_sched_deck.size() - 1) {
+            const auto replay_start = this->reuseSnapshots(reportStep, before_action, std::move(previous));
+            if (replay_start > reportStep + 1)
+                OpmLog::info(fmt::format("{}Reusing report steps {}-{} from previous Schedule processing",
+                                         prefix, reportStep + 1, replay_start - 1));
+
+            if (replay_start < this->m_sched_deck.size())
+                iterateScheduleSection(replay_start, this->m_sched_deck.size(), parseContext, errors, grid, &target_wellpi, prefix);
+        }
         OpmLog::info("\\----------------------------------------------------------------------");
 
         return sim_update;
@@ -1332,6 +1350,163 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
 
+namespace {
+
+    // Names of the objects in @after which have been modified relative to
+    // @before.  Returns std::nullopt if objects have been added or removed.
+    template <typename T>
+    std::optional<std::vector<std::string>>
+    modified_objects(const ScheduleState::map_member<std::string, T>& before,
+                     const ScheduleState::map_member<std::string, T>& after)
+    {
+        if (before.size() != after.size())
+            return std::nullopt;
+
+        std::vector<std::string> modified;
+        for (const auto& [name, ptr] : after) {
+            const auto before_ptr = before.get_ptr(name);
+            if (!before_ptr)
+                return std::nullopt;
+
+            if (before_ptr != ptr)
+                modified.push_back(name);
+        }
+        return modified;
+    }
+
+    template <typename T>
+    bool same_objects(const ScheduleState::map_member<std::string, T>& before,
+                      const ScheduleState::map_member<std::string, T>& after,
+                      const std::vector<std::string>& names)
+    {
+        return std::all_of(names.begin(), names.end(),
+                           [&before, &after](const std::string& name)
+                           { return after.has(name) && (before.get_ptr(name) == after.get_ptr(name)); });
+    }
+
+    bool matches_name(const std::string& value, const std::vector<std::string>& names)
+    {
+        // Well lists and the ACTIONX well placeholder can refer to any well.
+        if ((!value.empty() && value[0] == '*') || value == "?")
+            return true;
+
+        // Most items are plain names, which only match themselves.
+        if (value.find_first_of("*?[\\") == std::string::npos)
+            return std::find(names.begin(), names.end(), value) != names.end();
+
+        const ShellPattern pattern(value);
+        return std::any_of(names.begin(), names.end(),
+                           [&pattern](const std::string& name) { return pattern.match(name); });
+    }
+
+    /*
+      Conservative test of whether @keyword can modify any of the wells or
+      groups in @names: true if any string item matches one of the names or
+      can refer to a well list, or if the keyword applies to all wells.
+    */
+    bool references_objects(const DeckKeyword& keyword, const std::vector<std::string>& names)
+    {
+        if (keyword.is<ParserKeywords::WHISTCTL>() || keyword.is<ParserKeywords::WPAVE>())
+            return true;
+
+        for (const auto& record : keyword) {
+            for (const auto& item : record) {
+                const auto type = item.getType();
+                if (type != type_tag::string && type != type_tag::raw_string)
+                    continue;
+
+                for (std::size_t index = 0; index < item.data_size(); index++) {
+                    if (!item.hasValue(index))
+                        continue;
+
+                    const auto value = (type == type_tag::string)
+                        ? item.get<std::string>(index)
+                        : static_cast<std::string>(item.get<RawString>(index));
+
+                    if (matches_name(value, names))
+                        return true;
+                }
+            }
+        }
+        return false;
+    }
+
+}
+
+    /*
+      When an action has been applied at @report_step only the wells and
+      groups modified by the action can differ from the previous processing
+      of the remaining Schedule section.  The snapshots in @previous are
+      reused, with the modified wells and groups propagated forward, for as
+      long as neither the previous processing nor the keywords in the
+      following blocks touch any of the modified objects.  Any other change
+      to the ScheduleState - e.g. new wells or groups, UDQ or network
+      updates - requires the full Schedule section to be processed again.
+
+      Returns the first report step which must be processed again.
+    */
+    std::size_t Schedule::reuseSnapshots(const std::size_t report_step,
+                                         const ScheduleState& before_action,
+                                         std::vector<ScheduleState>&& previous)
+    {
+        const auto& after_action = this->snapshots[report_step];
+
+        // The events, WELPI targets and geo keywords only apply to the
+        // current report step.
+        auto masked = after_action;
+        masked.wells = before_action.wells;
+        masked.groups = before_action.groups;
+        masked.update_events(before_action.events());
+        masked.update_wellgroup_events(before_action.wellgroup_events());
+        masked.update_geo_keywords(before_action.geo_keywords());
+        masked.target_wellpi = before_action.target_wellpi;
+        if (!(masked == before_action) ||
+            !(masked.rst_config() == before_action.rst_config()) ||
+            !(masked.pavg() == before_action.pavg()))
+            return report_step + 1;
+
+        const auto modified_wells = modified_objects(before_action.wells, after_action.wells);
+        const auto modified_groups = modified_objects(before_action.groups, after_action.groups);
+        if (!modified_wells.has_value() || !modified_groups.has_value())
+            return report_step + 1;
+
+        // Keywords applied to the parent group of a modified well are
+        // treated as touching the well.
+        auto names = modified_groups.value();
+        for (const auto& wname : modified_wells.value()) {
+            names.push_back(wname);
+            names.push_back(before_action.wells(wname).groupName());
+            names.push_back(after_action.wells(wname).groupName());
+        }
+
+        for (auto& state : previous) {
+            const auto step = this->snapshots.size();
+            if (!same_objects(before_action.wells, state.wells, modified_wells.value()) ||
+                !same_objects(before_action.groups, state.groups, modified_groups.value()))
+                return step;
+
+            const auto& block = this->m_sched_deck[step];
+            const auto touched = std::any_of(block.begin(), block.end(),
+                                             [&names](const DeckKeyword& keyword)
+                                             { return references_objects(keyword, names); });
+            if (touched)
+                return step;
+
+            const auto& prev_state = this->snapshots.back();
+            for (const auto& wname : modified_wells.value())
+                state.wells.update(wname, prev_state.wells);
+
+            for (const auto& gname : modified_groups.value())
+                state.groups.update(gname, prev_state.groups);
+
+            this->snapshots.push_back(std::move(state));
+            this->end_report(step);
+        }
+
+        return this->snapshots.size();
+    }
+
+
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
         if (reportStep >= this->snapshots.size())
             return;
@@ -1339,6 +1514,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (!this->snapshots[reportStep].wells.has(well_name))
             return;
 
+        this->m_generation++;
         std::vector<Well *> unique_wells;
         for (std::size_t step = reportStep; step < this->snapshots.size(); step++) {
             auto& well = this->snapshots[step].wells.get(well_name);
@@ -1904,6 +2080,122 @@ const ScheduleState& Schedule::operator[](std::size_t index) const {
     return this->snapshots.at(index);
 }
 
+namespace {
+
+class MemoryCounter {
+public:
+    MemoryCounter(ScheduleMemoryReport& report_arg, std::size_t num_steps)
+        : report(report_arg)
+    {
+        this->report.step_bytes.assign(num_steps, 0);
+    }
+
+    template <typename T>
+    void add(const std::string& member, const T& object, std::size_t report_step) {
+        if (!this->seen.insert(&object).second)
+            return;
+
+        this->count(member, this->size(object), report_step);
+    }
+
+    void add_well(const Well& well, std::size_t report_step) {
+        if (!this->seen.insert(&well).second)
+            return;
+
+        auto bytes = this->size(well);
+        auto property = [&bytes, report_step, this](const std::string& member, const auto& object) {
+            const auto object_bytes = this->size(object);
+            bytes -= std::min(bytes, object_bytes);
+            if (this->seen.insert(&object).second)
+                this->count(member, object_bytes, report_step);
+        };
+
+        property("Well::UnitSystem", well.units());
+        property("Well::Connections", well.getConnections());
+        property("Well::ProductionProperties", well.getProductionProperties());
+        property("Well::InjectionProperties", well.getInjectionProperties());
+        property("Well::EconLimits", well.getEconLimits());
+        property("Well::FoamProperties", well.getFoamProperties());
+        property("Well::PolymerProperties", well.getPolymerProperties());
+        property("Well::MICPProperties", well.getMICPProperties());
+        property("Well::BrineProperties", well.getBrineProperties());
+        property("Well::TracerProperties", well.getTracerProperties());
+        if (well.isMultiSegment())
+            property("Well::Segments", well.getSegments());
+
+        this->count("Well", bytes, report_step);
+    }
+
+private:
+    ScheduleMemoryReport& report;
+    std::unordered_set<const void*> seen;
+    std::unordered_map<const void*, std::size_t> sizes;
+
+    template <typename T>
+    std::size_t size(const T& object) {
+        auto iter = this->sizes.find(&object);
+        if (iter == this->sizes.end())
+            iter = this->sizes.emplace(&object, BinarySerializer::pack(object).size()).first;
+
+        return iter->second;
+    }
+
+    void count(const std::string& member, std::size_t bytes, std::size_t report_step) {
+        auto& entry = this->report.members[member];
+        entry.count += 1;
+        entry.bytes += bytes;
+        this->report.step_bytes[report_step] += bytes;
+    }
+};
+
+}
+
+std::size_t ScheduleMemoryReport::total_bytes() const {
+    std::size_t bytes = 0;
+    for (const auto& step : this->step_bytes)
+        bytes += step;
+    return bytes;
+}
+
+ScheduleMemoryReport Schedule::memoryReport() const {
+    ScheduleMemoryReport report;
+    MemoryCounter counter(report, this->snapshots.size());
+
+    for (std::size_t step = 0; step < this->snapshots.size(); step++) {
+        const auto& state = this->snapshots[step];
+        counter.add("ScheduleState", state, step);
+
+        counter.add("PAvg", state.pavg(), step);
+        counter.add("WellTestConfig", state.wtest_config(), step);
+        counter.add("GConSale", state.gconsale(), step);
+        counter.add("GConSump", state.gconsump(), step);
+        counter.add("WListManager", state.wlist_manager(), step);
+        counter.add("Network::ExtNetwork", state.network(), step);
+        counter.add("Network::Balance", state.network_balance(), step);
+        counter.add("RPTConfig", state.rpt_config(), step);
+        counter.add("Action::Actions", state.actions(), step);
+        counter.add("UDQActive", state.udq_active(), step);
+        counter.add("UDQConfig", state.udq(), step);
+        counter.add("NameOrder", state.well_order(), step);
+        counter.add("GroupOrder", state.group_order(), step);
+        counter.add("GuideRateConfig", state.guide_rate(), step);
+        counter.add("GasLiftOpt", state.glo(), step);
+        counter.add("RFTConfig", state.rft_config(), step);
+        counter.add("RSTConfig", state.rst_config(), step);
+
+        for (const auto& table : state.vfpprod())
+            counter.add("VFPProdTable", table.get(), step);
+        for (const auto& table : state.vfpinj())
+            counter.add("VFPInjTable", table.get(), step);
+        for (const auto& group : state.groups())
+            counter.add("Group", group.get(), step);
+        for (const auto& well : state.wells())
+            counter.add_well(well.get(), step);
+    }
+
+    return report;
+}
+
 std::vector<ScheduleState>::const_iterator Schedule::begin() const {
     return this->snapshots.begin();
 }
@@ -17,11 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
 #include <cstring>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 #include <opm/common/utility/Serializer.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
@@ -30,6 +33,11 @@
 namespace Opm{
 namespace {
 
+    std::size_t next_layout_id() {
+        static std::atomic<std::size_t> layout_counter{0};
+        return layout_counter++;
+    }
+
     bool is_total(const std::string& key) {
         static const std::vector<std::string> totals = {"OPT"  , "GPT"  , "WPT" , "GIT", "WIT", "OPTF" , "OPTS" , "OIT"  , "OVPT" , "OVIT" , "MWT" ,
                                                         "WVPT" , "WVIT" , "GMT"  , "GPTF" , "SGT"  , "GST" , "FGT" , "GCT" , "GIMT" ,
@@ -57,47 +65,114 @@ namespace {
     using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
 
     template <class T>
-    bool has_var(const map2<T>& values, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
+    std::optional<T> find_var(const map2<T>& index, const std::string& var1, const std::string& var2) {
+        const auto& var1_iter = index.find(var1);
+        if (var1_iter == index.end())
+            return std::nullopt;
 
         const auto& var2_iter = var1_iter->second.find(var2);
         if (var2_iter == var1_iter->second.end())
-            return false;
+            return std::nullopt;
+
+        return var2_iter->second;
+    }
+
+    /*
+      The values in the SummaryState are addressed through index maps from
+      name to slot; the present_values() functions expand an index map to
+      the corresponding map of the values which are present.
+    */
+    template <class K>
+    std::unordered_map<K, double> present_values(const std::unordered_map<K, std::size_t>& index,
+                                                 const std::vector<double>& values,
+                                                 const std::vector<char>& present) {
+        std::unordered_map<K, double> value_map;
+        for (const auto& [key, slot] : index) {
+            if (present[slot])
+                value_map.emplace(key, values[slot]);
+        }
+        return value_map;
+    }
+
+    template <class T, class Index>
+    auto present_values(const std::unordered_map<T, Index>& index,
+                        const std::vector<double>& values,
+                        const std::vector<char>& present) {
+        std::unordered_map<T, decltype(present_values(std::declval<const Index&>(), values, present))> value_map;
+        for (const auto& [key, sub_index] : index) {
+            auto sub_values = present_values(sub_index, values, present);
+            if (!sub_values.empty())
+                value_map.emplace(key, std::move(sub_values));
+        }
+        return value_map;
+    }
 
-        return true;
+    template <class K>
+    void put_values(Serializer& ser, const std::unordered_map<K, double>& values) {
+        ser.put(values.size());
+        for (const auto& [key, value] : values) {
+            ser.put(key);
+            ser.put(value);
+        }
     }
+}
 
-    template <class T>
-    void erase_var(map2<T>& values, std::set<std::string>& var2_set, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
 
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
-            }
-        }
+    SummaryState::const_iterator::const_iterator(const SummaryState* state_arg, std::size_t index_arg) :
+        state(state_arg),
+        index(index_arg)
+    {
+        this->skip_absent();
     }
 
-    template <class T>
-    std::vector<std::string> var2_list(const map2<T>& values, const std::string& var1) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return {};
+    void SummaryState::const_iterator::skip_absent() {
+        const auto& keys = this->state->m_keys;
+        while (this->index < keys.size() && !this->state->m_present[keys[this->index].second])
+            this->index++;
+    }
 
-        std::vector<std::string> l;
-        for (const auto& pair : var1_iter->second)
-            l.push_back(pair.first);
-        return l;
+    SummaryState::const_iterator::reference SummaryState::const_iterator::operator*() const {
+        const auto& [key, slot] = this->state->m_keys[this->index];
+        return { key, this->state->m_values[slot] };
+    }
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++() {
+        this->index++;
+        this->skip_absent();
+        return *this;
+    }
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int) {
+        auto iter = *this;
+        ++(*this);
+        return iter;
+    }
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& other) const {
+        return this->state == other.state && this->index == other.index;
+    }
+
+    bool SummaryState::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+    }
+
+
+    SummaryState::LayoutId::LayoutId() :
+        value(next_layout_id())
+    {}
+
+    SummaryState::LayoutId::LayoutId(const LayoutId&) :
+        value(next_layout_id())
+    {}
+
+    SummaryState::LayoutId& SummaryState::LayoutId::operator=(const LayoutId&) {
+        this->value = next_layout_id();
+        return *this;
+    }
+
+    std::size_t SummaryState::layout_id() const {
+        return this->m_layout.value;
     }
-}
 
 
     SummaryState::SummaryState(time_point sim_start_arg):
@@ -111,6 +186,140 @@ namespace {
     {}
 
 
+    std::size_t SummaryState::add_slot(SlotOwner::Kind kind, const std::string& name, const std::string& var) {
+        auto var_iter = this->version_index.find(var);
+        if (var_iter == this->version_index.end()) {
+            var_iter = this->version_index.emplace(var, this->m_var_versions.size()).first;
+            this->m_var_versions.push_back(0);
+        }
+
+        this->m_values.push_back(0);
+        this->m_present.push_back(0);
+        this->m_slots.push_back({kind, name, var_iter->second});
+        return this->m_values.size() - 1;
+    }
+
+    std::size_t SummaryState::key_slot(const std::string& key) {
+        const auto iter = this->key_index.find(key);
+        if (iter != this->key_index.end())
+            return iter->second;
+
+        const auto slot = this->add_slot(SlotOwner::Kind::General, "", key);
+        this->key_index.emplace(key, slot);
+        this->m_keys.emplace_back(key, slot);
+        return slot;
+    }
+
+    std::size_t SummaryState::var_slot(map2<std::size_t>& index, SlotOwner::Kind kind, const std::string& name, const std::string& var) {
+        auto& var_index = index[var];
+        const auto iter = var_index.find(name);
+        if (iter != var_index.end())
+            return iter->second;
+
+        const auto slot = this->add_slot(kind, name, var);
+        var_index.emplace(name, slot);
+        return slot;
+    }
+
+    std::optional<std::size_t> SummaryState::find_key(const std::string& key) const {
+        const auto iter = this->key_index.find(key);
+        if (iter == this->key_index.end())
+            return std::nullopt;
+
+        return iter->second;
+    }
+
+    bool SummaryState::present(const std::optional<std::size_t>& slot) const {
+        return slot.has_value() && this->m_present[*slot];
+    }
+
+    void SummaryState::update_slot(std::size_t slot, bool total, double value) {
+        if (total && this->m_present[slot]) {
+            if (value != 0)
+                this->changed(slot);
+
+            this->m_values[slot] += value;
+        } else {
+            if (!this->m_present[slot] || this->m_values[slot] != value)
+                this->changed(slot);
+
+            this->m_values[slot] = value;
+        }
+
+        this->m_present[slot] = 1;
+    }
+
+    void SummaryState::changed(std::size_t slot) {
+        this->m_var_versions[this->m_slots[slot].var] = ++this->m_version;
+    }
+
+    void SummaryState::names_changed() {
+        this->m_names_version = ++this->m_version;
+    }
+
+    std::size_t SummaryState::version(const std::string& var) const {
+        const auto iter = this->version_index.find(var);
+        if (iter == this->version_index.end())
+            return 0;
+
+        return this->m_var_versions[iter->second];
+    }
+
+    std::size_t SummaryState::names_version() const {
+        return this->m_names_version;
+    }
+
+    void SummaryState::reset_values() {
+        std::fill(this->m_present.begin(), this->m_present.end(), 0);
+        this->m_wells.clear();
+        this->well_names.reset();
+        this->m_groups.clear();
+        this->group_names.reset();
+    }
+
+
+    SummaryState::Handle SummaryState::handle(const std::string& key) {
+        return Handle(this->key_slot(key), Handle::npos, is_total(key));
+    }
+
+    SummaryState::Handle SummaryState::well_var_handle(const std::string& well, const std::string& var) {
+        const auto slot = this->var_slot(this->well_index, SlotOwner::Kind::Well, well, var);
+        return Handle(this->key_slot(var + ":" + well), slot, is_total(var));
+    }
+
+    SummaryState::Handle SummaryState::group_var_handle(const std::string& group, const std::string& var) {
+        const auto slot = this->var_slot(this->group_index, SlotOwner::Kind::Group, group, var);
+        return Handle(this->key_slot(var + ":" + group), slot, is_total(var));
+    }
+
+    std::optional<SummaryState::Handle> SummaryState::find_handle(const std::string& key) const {
+        const auto slot = this->find_key(key);
+        if (!slot.has_value())
+            return std::nullopt;
+
+        return Handle(*slot, Handle::npos, is_total(key));
+    }
+
+    std::optional<SummaryState::Handle> SummaryState::find_well_var_handle(const std::string& well, const std::string& var) const {
+        const auto slot = find_var(this->well_index, var, well);
+        const auto key_slot = this->find_key(var + ":" + well);
+        if (!slot.has_value() || !key_slot.has_value())
+            return std::nullopt;
+
+        return Handle(*key_slot, *slot, is_total(var));
+    }
+
+    SummaryState::Handle SummaryState::conn_var_handle(const std::string& well, const std::string& var, std::size_t global_index) {
+        auto& conn_map = this->conn_index[var][well];
+        auto iter = conn_map.find(global_index);
+        if (iter == conn_map.end())
+            iter = conn_map.emplace(global_index, this->add_slot(SlotOwner::Kind::Connection, well, var)).first;
+
+        const auto key = var + ":" + well + ":" + std::to_string(global_index);
+        return Handle(this->key_slot(key), iter->second, is_total(var));
+    }
+
+
     void SummaryState::update_elapsed(double delta) {
         this->elapsed += delta;
     }
@@ -121,65 +330,60 @@ namespace {
     }
 
 
+    void SummaryState::update(const Handle& handle, double value) {
+        this->update_slot(handle.key_slot, handle.total, value);
+        if (handle.var_slot == Handle::npos)
+            return;
+
+        if (!this->m_present[handle.var_slot]) {
+            const auto& owner = this->m_slots[handle.var_slot];
+            if (owner.kind == SlotOwner::Kind::Well) {
+                if (this->m_wells.insert(owner.name).second) {
+                    this->well_names.reset();
+                    this->names_changed();
+                }
+            } else if (owner.kind == SlotOwner::Kind::Group) {
+                if (this->m_groups.insert(owner.name).second) {
+                    this->group_names.reset();
+                    this->names_changed();
+                }
+            }
+        }
+        this->update_slot(handle.var_slot, handle.total, value);
+    }
+
+
     void SummaryState::update(const std::string& key, double value) {
-        if (is_total(key))
-            this->values[key] += value;
-        else
-            this->values[key] = value;
+        this->update(this->handle(key), value);
     }
 
 
     void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
-        std::string key = var + ":" + group;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->group_values[var][group] += value;
-        } else {
-            this->values[key] = value;
-            this->group_values[var][group] = value;
-        }
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update(this->group_var_handle(group, var), value);
     }
 
     void SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
-        std::string key = var + ":" + well;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->well_values[var][well] += value;
-        } else {
-            this->values[key] = value;
-            this->well_values[var][well] = value;
-        }
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update(this->well_var_handle(well, var), value);
     }
 
     bool SummaryState::has_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const {
-        if (!has_var(this->conn_values, var, well))
+        const auto well_map = find_var(this->conn_index, var, well);
+        if (!well_map.has_value())
             return false;
 
-        const auto& index_map = this->conn_values.at(var).at(well);
-        return (index_map.count(global_index) > 0);
+        const auto iter = well_map->find(global_index);
+        return iter != well_map->end() && this->m_present[iter->second];
     }
 
     void SummaryState::update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value) {
-        std::string key = var + ":" + well + ":" + std::to_string(global_index);
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->conn_values[var][well][global_index] += value;
-        } else {
-            this->values[key] = value;
-            this->conn_values[var][well][global_index] = value;
-        }
+        this->update(this->conn_var_handle(well, var, global_index), value);
     }
 
     double SummaryState::get_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const {
-        return this->conn_values.at(var).at(well).at(global_index);
+        if (!this->has_conn_var(well, var, global_index))
+            throw std::out_of_range("No such connection variable: " + var + ":" + well + ":" + std::to_string(global_index));
+
+        return this->m_values[this->conn_index.at(var).at(well).at(global_index)];
     }
 
     double SummaryState::get_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double default_value) const {
@@ -194,28 +398,39 @@ namespace {
         if (var_type == UDQVarType::WELL_VAR) {
             const std::vector<std::string> wells = this->wells();
             for (const auto& well : wells) {
-                const auto& udq_value = udq_set[well].value();
+                const auto udq_value = udq_set[well].value();
                 this->update_well_var(well, udq_set.name(), udq_value.value_or(undefined_value));
             }
         } else if (var_type == UDQVarType::GROUP_VAR) {
             const std::vector<std::string> groups = this->groups();
             for (const auto& group : groups) {
-                const auto& udq_value = udq_set[group].value();
+                const auto udq_value = udq_set[group].value();
                 this->update_group_var(group, udq_set.name(), udq_value.value_or(undefined_value));
             }
         } else {
-            const auto& udq_var = udq_set[0].value();
+            const auto udq_var = udq_set[0].value();
             this->update(udq_set.name(), udq_var.value_or(undefined_value));
         }
     }
 
 
     void SummaryState::set(const std::string& key, double value) {
-        this->values[key] = value;
+        const auto slot = this->key_slot(key);
+        if (!this->m_present[slot] || this->m_values[slot] != value)
+            this->changed(slot);
+
+        this->m_values[slot] = value;
+        this->m_present[slot] = 1;
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        const auto slot = this->find_key(key);
+        if (!this->present(slot))
+            return false;
+
+        this->m_present[*slot] = 0;
+        this->changed(*slot);
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var) {
@@ -223,8 +438,22 @@ namespace {
         if (!this->erase(key))
             return false;
 
-        erase_var(this->well_values, this->m_wells, var, well);
+        const auto slot = find_var(this->well_index, var, well);
+        if (this->present(slot)) {
+            this->m_present[*slot] = 0;
+            this->changed(*slot);
+        }
+
+        this->m_wells.clear();
+        for (const auto& [_, well_map] : present_values(this->well_index, this->m_values, this->m_present)) {
+            (void)_;
+            for (const auto& [w, __] : well_map) {
+                (void)__;
+                this->m_wells.insert(w);
+            }
+        }
         this->well_names.reset();
+        this->names_changed();
         return true;
     }
 
@@ -233,41 +462,84 @@ namespace {
         if (!this->erase(key))
             return false;
 
-        erase_var(this->group_values, this->m_groups, var, group);
+        const auto slot = find_var(this->group_index, var, group);
+        if (this->present(slot)) {
+            this->m_present[*slot] = 0;
+            this->changed(*slot);
+        }
+
+        this->m_groups.clear();
+        for (const auto& [_, group_map] : present_values(this->group_index, this->m_values, this->m_present)) {
+            (void)_;
+            for (const auto& [g, __] : group_map) {
+                (void)__;
+                this->m_groups.insert(g);
+            }
+        }
         this->group_names.reset();
+        this->names_changed();
         return true;
     }
 
+    bool SummaryState::has(const Handle& handle) const {
+        const auto slot = handle.var_slot == Handle::npos ? handle.key_slot : handle.var_slot;
+        return this->m_present[slot];
+    }
+
     bool SummaryState::has(const std::string& key) const {
-        return (this->values.find(key) != this->values.end());
+        return this->present(this->find_key(key));
+    }
+
+    double SummaryState::get(const Handle& handle) const {
+        if (!this->has(handle))
+            throw std::out_of_range("No value for summary variable handle");
+
+        const auto slot = handle.var_slot == Handle::npos ? handle.key_slot : handle.var_slot;
+        return this->m_values[slot];
+    }
+
+    double SummaryState::get(const Handle& handle, double default_value) const {
+        if (!this->has(handle))
+            return default_value;
+
+        return this->get(handle);
     }
 
     double SummaryState::get(const std::string& key, double default_value) const {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto slot = this->find_key(key);
+        if (!this->present(slot))
             return default_value;
 
-        return iter->second;
+        return this->m_values[*slot];
     }
 
     double SummaryState::get(const std::string& key) const {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto slot = this->find_key(key);
+        if (!this->present(slot))
             throw std::out_of_range("No such key: " + key);
 
-        return iter->second;
+        return this->m_values[*slot];
     }
 
     bool SummaryState::has_well_var(const std::string& well, const std::string& var) const {
-        return has_var(this->well_values, var, well);
+        return this->present(find_var(this->well_index, var, well));
     }
 
     bool SummaryState::has_well_var(const std::string& var) const {
-        return this->well_values.count(var) != 0;
+        const auto iter = this->well_index.find(var);
+        if (iter == this->well_index.end())
+            return false;
+
+        return std::any_of(iter->second.begin(), iter->second.end(),
+                           [this](const auto& well_slot) { return this->m_present[well_slot.second]; });
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var) const {
-        return this->well_values.at(var).at(well);
+        const auto slot = find_var(this->well_index, var, well);
+        if (!this->present(slot))
+            throw std::out_of_range("No such well variable: " + var + ":" + well);
+
+        return this->m_values[*slot];
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var, double default_value) const {
@@ -278,15 +550,24 @@ namespace {
     }
 
     bool SummaryState::has_group_var(const std::string& group, const std::string& var) const {
-        return has_var(this->group_values, var, group);
+        return this->present(find_var(this->group_index, var, group));
     }
 
     bool SummaryState::has_group_var(const std::string& var) const {
-        return this->group_values.count(var) != 0;
+        const auto iter = this->group_index.find(var);
+        if (iter == this->group_index.end())
+            return false;
+
+        return std::any_of(iter->second.begin(), iter->second.end(),
+                           [this](const auto& group_slot) { return this->m_present[group_slot.second]; });
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var) const {
-        return this->group_values.at(var).at(group);
+        const auto slot = find_var(this->group_index, var, group);
+        if (!this->present(slot))
+            throw std::out_of_range("No such group variable: " + var + ":" + group);
+
+        return this->m_values[*slot];
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var, double default_value) const {
@@ -297,17 +578,26 @@ namespace {
     }
 
     SummaryState::const_iterator SummaryState::begin() const {
-        return this->values.begin();
+        return const_iterator(this, 0);
     }
 
 
     SummaryState::const_iterator SummaryState::end() const {
-        return this->values.end();
+        return const_iterator(this, this->m_keys.size());
     }
 
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const {
-        return var2_list(this->well_values, var);
+        std::vector<std::string> l;
+        const auto iter = this->well_index.find(var);
+        if (iter == this->well_index.end())
+            return l;
+
+        for (const auto& [well, slot] : iter->second) {
+            if (this->m_present[slot])
+                l.push_back(well);
+        }
+        return l;
     }
 
 
@@ -320,7 +610,16 @@ namespace {
 
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const {
-        return var2_list(this->group_values, var);
+        std::vector<std::string> l;
+        const auto iter = this->group_index.find(var);
+        if (iter == this->group_index.end())
+            return l;
+
+        for (const auto& [group, slot] : iter->second) {
+            if (this->m_present[slot])
+                l.push_back(group);
+        }
+        return l;
     }
 
 
@@ -336,38 +635,44 @@ namespace {
     }
 
     std::size_t SummaryState::size() const {
-        return this->values.size();
+        return std::count_if(this->m_keys.begin(), this->m_keys.end(),
+                             [this](const auto& key_slot) { return this->m_present[key_slot.second]; });
     }
 
 
 
-
+    /*
+      The serialized format is independent of the slot layout, and identical
+      to the format used when the values were stored in nested maps.
+    */
     std::vector<char> SummaryState::serialize() const {
         Serializer ser;
         ser.put(this->sim_start);
         ser.put(this->elapsed);
-        ser.put_map(this->values);
-
+        put_values(ser, present_values(this->key_index, this->m_values, this->m_present));
 
-        ser.put(this->well_values.size());
-        for (const auto& [var, well_map] : this->well_values) {
+        const auto well_values = present_values(this->well_index, this->m_values, this->m_present);
+        ser.put(well_values.size());
+        for (const auto& [var, well_map] : well_values) {
             ser.put(var);
-            ser.put_map(well_map);
+            put_values(ser, well_map);
         }
 
-        ser.put(this->group_values.size());
-        for (const auto& [var, group_map] : this->group_values) {
+        const auto group_values = present_values(this->group_index, this->m_values, this->m_present);
+        ser.put(group_values.size());
+        for (const auto& [var, group_map] : group_values) {
             ser.put(var);
-            ser.put_map(group_map);
+            put_values(ser, group_map);
         }
 
-        ser.put(this->conn_values.size());
-        for (const auto& [var, well_conn_map] : this->conn_values) {
+        const auto conn_values = present_values(this->conn_index, this->m_values, this->m_present);
+        ser.put(conn_values.size());
+        for (const auto& [var, well_conn_map] : conn_values) {
             ser.put(var);
             ser.put(well_conn_map.size());
             for (const auto& [well, conn_map] : well_conn_map) {
                 ser.put(well);
-                ser.put_map(conn_map);
+                put_values(ser, conn_map);
             }
         }
 
@@ -379,34 +684,35 @@ namespace {
         Serializer ser(buffer);
         this->sim_start = ser.get<time_point>();
         this->elapsed = ser.get<double>();
-        this->values = ser.get_map<std::string, double>();
+        this->reset_values();
+
+        for (const auto& [key, value] : ser.get_map<std::string, double>())
+            this->set(key, value);
 
         {
             std::size_t num_well_var = ser.get<std::size_t>();
             for (std::size_t var_index = 0; var_index < num_well_var; var_index++) {
                 std::string var = ser.get<std::string>();
-                auto v = ser.get_map<std::string, double>();
-                for (const auto& [well, _] : v) {
-                    (void)_;
+                for (const auto& [well, value] : ser.get_map<std::string, double>()) {
+                    const auto slot = this->var_slot(this->well_index, SlotOwner::Kind::Well, well, var);
+                    this->m_values[slot] = value;
+                    this->m_present[slot] = 1;
                     this->m_wells.insert(well);
                 }
-                this->well_values[var] = std::move(v);
             }
-            this->well_names.reset();
         }
 
         {
             std::size_t num_group_var = ser.get<std::size_t>();
             for (std::size_t var_index = 0; var_index < num_group_var; var_index++) {
                 std::string var = ser.get<std::string>();
-                auto v= ser.get_map<std::string, double>();
-                for (const auto& [group, _] : v) {
-                    (void)_;
+                for (const auto& [group, value] : ser.get_map<std::string, double>()) {
+                    const auto slot = this->var_slot(this->group_index, SlotOwner::Kind::Group, group, var);
+                    this->m_values[slot] = value;
+                    this->m_present[slot] = 1;
                     this->m_groups.insert(group);
                 }
-                this->group_values[var] = std::move(v);
             }
-            this->group_names.reset();
         }
 
         {
@@ -414,13 +720,25 @@ namespace {
             for (std::size_t var_index = 0; var_index < num_conn_var; var_index++) {
                 std::string var = ser.get<std::string>();
                 std::size_t num_wells = ser.get<std::size_t>();
-                for (std::size_t well_index = 0; well_index < num_wells; well_index++) {
+                for (std::size_t well_num = 0; well_num < num_wells; well_num++) {
                     std::string well = ser.get<std::string>();
-                    auto conn_map = ser.get_map<std::size_t, double>();
-                    this->conn_values[var][well] = std::move(conn_map);
+                    auto& conn_map = this->conn_index[var][well];
+                    for (const auto& [global_index, value] : ser.get_map<std::size_t, double>()) {
+                        auto iter = conn_map.find(global_index);
+                        if (iter == conn_map.end())
+                            iter = conn_map.emplace(global_index, this->add_slot(SlotOwner::Kind::Connection, well, var)).first;
+
+                        this->m_values[iter->second] = value;
+                        this->m_present[iter->second] = 1;
+                    }
                 }
             }
         }
+
+        // All values have been replaced.
+        for (auto& var_version : this->m_var_versions)
+            var_version = ++this->m_version;
+        this->names_changed();
     }
 
     std::ostream& operator<<(std::ostream& stream, const SummaryState& st) {
@@ -435,13 +753,17 @@ namespace {
     bool SummaryState::operator==(const SummaryState& other) const {
         return this->sim_start == other.sim_start &&
                this->elapsed == other.elapsed &&
-               this->values == other.values &&
-               this->well_values == other.well_values &&
+               present_values(this->key_index, this->m_values, this->m_present) ==
+                   present_values(other.key_index, other.m_values, other.m_present) &&
+               present_values(this->well_index, this->m_values, this->m_present) ==
+                   present_values(other.well_index, other.m_values, other.m_present) &&
                this->m_wells == other.m_wells &&
                this->wells() == other.wells() &&
-               this->group_values == other.group_values &&
+               present_values(this->group_index, this->m_values, this->m_present) ==
+                   present_values(other.group_index, other.m_values, other.m_present) &&
                this->m_groups == other.m_groups &&
                this->groups() == other.groups() &&
-               this->conn_values == other.conn_values;
+               present_values(this->conn_index, this->m_values, this->m_present) ==
+                   present_values(other.conn_index, other.m_values, other.m_present);
     }
 }
@@ -352,6 +352,22 @@ void UDQASTNode::required_summary(std::unordered_set<std::string>& summary_keys)
         this->right->required_summary(summary_keys);
 }
 
+void UDQASTNode::required_udq(std::unordered_set<std::string>& udq_keys) const {
+    if (this->type == UDQTokenType::ecl_expr) {
+        if (std::holds_alternative<std::string>(this->value)) {
+            const auto& keyword = std::get<std::string>(this->value);
+            if (is_udq(keyword))
+                udq_keys.insert(keyword);
+        }
+    }
+
+    if (this->left)
+        this->left->required_udq(udq_keys);
+
+    if (this->right)
+        this->right->required_udq(udq_keys);
+}
+
 UDQASTNode operator*(const UDQASTNode&lhs, double sign_factor) {
     UDQASTNode prod = lhs;
     prod.scale(sign_factor);
@@ -17,6 +17,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <exception>
+#include <optional>
+
 #include <fmt/format.h>
 
 #include <opm/io/eclipse/rst/state.hpp>
@@ -25,6 +29,7 @@
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
@@ -39,6 +44,18 @@ namespace Opm {
                 return s;
         }
 
+        // Smallest number of defines in one level which are evaluated
+        // concurrently.
+        constexpr std::size_t min_parallel_defines = 8;
+
+        bool uses_random(const UDQDefine& def) {
+            const auto tokens = def.func_tokens();
+            return tokens.count(UDQTokenType::elemental_func_randn) ||
+                   tokens.count(UDQTokenType::elemental_func_randu) ||
+                   tokens.count(UDQTokenType::elemental_func_rrandn) ||
+                   tokens.count(UDQTokenType::elemental_func_rrandu);
+        }
+
     }
 
     UDQConfig::UDQConfig(const UDQParams& params) :
@@ -79,6 +96,7 @@ namespace Opm {
     }
 
     void UDQConfig::add_node( const std::string& quantity, UDQAction action) {
+        this->m_eval_plan.reset();
         auto index_iter = this->input_index.find(quantity);
         if (this->input_index.find(quantity) == this->input_index.end()) {
             auto var_type = UDQ::varType(quantity);
@@ -374,25 +392,165 @@ namespace Opm {
     }
 
 
-    void UDQConfig::eval_define(std::size_t report_step, UDQState& udq_state, UDQContext& context) const {
-        for (const auto& def : this->definitions(UDQVarType::WELL_VAR)) {
-            if (udq_state.define(def.keyword(), def.status())) {
-                auto ws = def.eval(context);
-                context.update_define(report_step, def.keyword(), ws);
+    /*
+      The defines are evaluated as well, group and field defines, each in
+      input order; a define sees the new value of the UDQs evaluated before
+      it and the previous value of the UDQs evaluated after it.
+    */
+    const UDQConfig::EvalPlan& UDQConfig::eval_plan() const {
+        if (this->m_eval_plan)
+            return *this->m_eval_plan;
+
+        auto plan = std::make_shared<EvalPlan>();
+        for (const auto& var_type : {UDQVarType::WELL_VAR, UDQVarType::GROUP_VAR, UDQVarType::FIELD_VAR}) {
+            for (const auto& [keyword, index] : this->input_index) {
+                if (index.action != UDQAction::DEFINE)
+                    continue;
+
+                const auto& def = this->m_definitions.at(keyword);
+                if (def.var_type() != var_type)
+                    continue;
+
+                std::unordered_set<std::string> summary_keys;
+                std::unordered_set<std::string> udq_keys;
+                def.required_summary(summary_keys);
+                def.required_udq(udq_keys);
+
+                auto& node = plan->nodes.emplace_back();
+                node.keyword = keyword;
+                node.summary_keys.assign(summary_keys.begin(), summary_keys.end());
+                node.udq_keys.assign(udq_keys.begin(), udq_keys.end());
+                node.random = uses_random(def);
             }
         }
 
-        for (const auto& def : this->definitions(UDQVarType::GROUP_VAR)) {
-            if (udq_state.define(def.keyword(), def.status())) {
-                auto ws = def.eval(context);
-                context.update_define(report_step, def.keyword(), ws);
+        std::unordered_map<std::string, std::size_t> position;
+        for (std::size_t index = 0; index < plan->nodes.size(); index++)
+            position.emplace(plan->nodes[index].keyword, index);
+
+        // A define which is read by an earlier define must not be updated
+        // before that define has been evaluated, i.e. it can not be placed
+        // in an earlier level.
+        std::vector<std::size_t> min_level(plan->nodes.size(), 0);
+        std::optional<std::size_t> random_level;
+        for (std::size_t index = 0; index < plan->nodes.size(); index++) {
+            const auto& node = plan->nodes[index];
+            auto level = min_level[index];
+            for (const auto& udq_key : node.udq_keys) {
+                const auto dep_iter = position.find(udq_key);
+                if (dep_iter != position.end() && dep_iter->second < index)
+                    level = std::max(level, min_level[dep_iter->second] + 1);
             }
+
+            if (node.random) {
+                if (random_level.has_value())
+                    level = std::max(level, *random_level + 1);
+                random_level = level;
+            }
+
+            min_level[index] = level;
+            for (const auto& udq_key : node.udq_keys) {
+                const auto dep_iter = position.find(udq_key);
+                if (dep_iter != position.end() && dep_iter->second > index)
+                    min_level[dep_iter->second] = std::max(min_level[dep_iter->second], level);
+            }
+
+            if (plan->levels.size() <= level)
+                plan->levels.resize(level + 1);
+            plan->levels[level].push_back(index);
         }
 
-        for (const auto& def : this->definitions(UDQVarType::FIELD_VAR)) {
-            if (udq_state.define(def.keyword(), def.status())) {
-                auto field_udq = def.eval(context);
-                context.update_define(report_step, def.keyword(), field_udq);
+        this->m_eval_plan = plan;
+        return *plan;
+    }
+
+
+    /*
+      A define is only evaluated when the versions of the summary variables
+      and UDQs it reads, or of its own result, have changed since it was
+      last evaluated; otherwise the UDQState and SummaryState already hold
+      the result of the evaluation. The defines which use the random number
+      functions are always evaluated.
+    */
+    void UDQConfig::eval_define(std::size_t report_step, UDQState& udq_state, UDQContext& context) const {
+        const auto& plan = this->eval_plan();
+        auto& st = context.summary();
+        auto& records = udq_state.define_records(report_step, st, context.wells());
+
+        const auto versions = [&st, &udq_state](const EvalNode& node) {
+            std::vector<std::size_t> node_versions;
+            node_versions.reserve(node.summary_keys.size() + node.udq_keys.size() + 2);
+            for (const auto& key : node.summary_keys)
+                node_versions.push_back(st.version(key));
+
+            for (const auto& key : node.udq_keys)
+                node_versions.push_back(udq_state.version(key));
+
+            node_versions.push_back(udq_state.version(node.keyword));
+            node_versions.push_back(st.version(node.keyword));
+            return node_versions;
+        };
+
+        // The lists of wells and groups are assembled on first use, that
+        // must not happen while the defines are evaluated concurrently.
+        st.wells();
+        st.groups();
+
+        std::vector<const UDQDefine*> pending;
+        std::vector<const EvalNode*> pending_nodes;
+        std::vector<std::vector<std::size_t>> pending_versions;
+        for (const auto& level : plan.levels) {
+            pending.clear();
+            pending_nodes.clear();
+            pending_versions.clear();
+            for (const auto& index : level) {
+                const auto& node = plan.nodes[index];
+                const auto& def = this->m_definitions.at(node.keyword);
+                if (!udq_state.define(node.keyword, def.status()))
+                    continue;
+
+                auto node_versions = versions(node);
+                const auto record = records.find(node.keyword);
+                if (!node.random &&
+                    record != records.end() &&
+                    record->second.versions == node_versions &&
+                    record->second.expression == def.input_string())
+                    continue;
+
+                pending.push_back(&def);
+                pending_nodes.push_back(&node);
+                pending_versions.push_back(std::move(node_versions));
+            }
+
+            const int num_pending = pending.size();
+            const bool parallel = pending.size() >= min_parallel_defines;
+            if (parallel) {
+                for (const auto* def : pending)
+                    def->bind(context);
+            }
+
+            std::vector<std::optional<UDQSet>> results(num_pending);
+            std::vector<std::exception_ptr> errors(num_pending);
+#pragma omp parallel for schedule(dynamic) if(parallel)
+            for (int index = 0; index < num_pending; index++) {
+                try {
+                    results[index] = pending[index]->eval(context);
+                } catch (...) {
+                    errors[index] = std::current_exception();
+                }
+            }
+
+            for (int index = 0; index < num_pending; index++) {
+                if (errors[index])
+                    std::rethrow_exception(errors[index]);
+
+                const auto& node = *pending_nodes[index];
+                context.update_define(report_step, node.keyword, *results[index]);
+
+                auto& node_versions = pending_versions[index];
+                node_versions[node_versions.size() - 2] = udq_state.version(node.keyword);
+                node_versions[node_versions.size() - 1] = st.version(node.keyword);
+                records[node.keyword] = { pending[index]->input_string(), std::move(node_versions) };
             }
         }
     }
@@ -131,6 +131,10 @@ bool is_udq(const std::string& key) {
         return this->udqft;
     }
 
+    SummaryState& UDQContext::summary() const {
+        return this->summary_state;
+    }
+
     void UDQContext::update_assign(std::size_t report_step, const std::string& keyword, const UDQSet& udq_result) {
         this->udq_state.add_assign(report_step, keyword, udq_result);
         this->summary_state.update_udq(udq_result, this->udq_state.undefined_value());
@@ -28,6 +28,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
@@ -197,6 +198,7 @@ UDQDefine::UDQDefine(const UDQParams& udq_params,
     }
     this->m_tokens = make_tokens(string_tokens);
     this->ast = std::make_shared<UDQASTNode>( UDQParser::parse(udq_params, this->m_var_type, this->m_keyword, this->m_location, this->m_tokens, parseContext, errors) );
+    this->m_program.program = std::make_shared<UDQProgram>(*this->ast);
 }
 
 void UDQDefine::update_status(UDQUpdate update, std::size_t report_step) {
@@ -245,10 +247,27 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
     this->ast->required_summary(summary_keys);
 }
 
-UDQSet UDQDefine::eval(const UDQContext& context) const {
+void UDQDefine::required_udq(std::unordered_set<std::string>& udq_keys) const {
+    this->ast->required_udq(udq_keys);
+}
+
+void UDQDefine::bind(const UDQContext& context) const {
+    this->compiled().bind(context);
+}
+
+const UDQProgram& UDQDefine::compiled() const {
+    auto& program = this->m_program.program;
+    if (!program)
+        program = std::make_shared<UDQProgram>(*this->ast);
+
+    return *program;
+}
+
+template <typename Evaluator>
+UDQSet UDQDefine::eval_with(Evaluator&& evaluator, const UDQContext& context) const {
     std::optional<UDQSet> res;
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        res = evaluator(this->m_var_type);
         res->name( this->m_keyword );
         if (!dynamic_type_check(this->var_type(), res->var_type())) {
             std::string msg = "Invalid runtime type conversion detected when evaluating UDQ";
@@ -282,7 +301,7 @@ UDQSet UDQDefine::eval(const UDQContext& context) const {
           regarding the semantics of group sets.
         */
 
-        const auto& scalar_value = res->operator[](0).value();
+        const auto scalar_value = res->operator[](0).value();
         if (this->var_type() == UDQVarType::WELL_VAR) {
             const std::vector<std::string> wells = context.wells();
             UDQSet well_res = UDQSet::wells(this->m_keyword, wells);
@@ -307,6 +326,15 @@ UDQSet UDQDefine::eval(const UDQContext& context) const {
     return *res;
 }
 
+UDQSet UDQDefine::eval(const UDQContext& context) const {
+    const auto& compiled = this->compiled();
+    return this->eval_with([&compiled, &context](UDQVarType target_type) { return compiled.eval(target_type, context); }, context);
+}
+
+UDQSet UDQDefine::eval_tree(const UDQContext& context) const {
+    return this->eval_with([this, &context](UDQVarType target_type) { return this->ast->eval(target_type, context); }, context);
+}
+
 const KeywordLocation& UDQDefine::location() const {
     return this->m_location;
 }
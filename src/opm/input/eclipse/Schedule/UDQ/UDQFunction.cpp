@@ -165,9 +165,8 @@ UDQUnaryElementalFunction::UDQUnaryElementalFunction(const std::string&name, std
 UDQSet UDQUnaryElementalFunction::ABS(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
-            result.assign( index, std::fabs(udq_value.get()));
+        if (result.defined(index))
+            result.assign( index, std::fabs(result.get(index)));
     }
     return result;
 }
@@ -175,8 +174,7 @@ UDQSet UDQUnaryElementalFunction::ABS(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::DEF(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
+        if (result.defined(index))
             result.assign( index, 1 );
     }
     return result;
@@ -186,8 +184,7 @@ UDQSet UDQUnaryElementalFunction::DEF(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::UNDEF(const UDQSet& arg) {
     UDQSet result(arg.name(), arg.size());
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = arg[index];
-        if (!udq_value)
+        if (!arg.defined(index))
             result.assign( index, 1 );
     }
     return result;
@@ -197,8 +194,7 @@ UDQSet UDQUnaryElementalFunction::UNDEF(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::IDV(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
+        if (result.defined(index))
             result.assign( index, 1 );
         else
             result.assign(index , 0);
@@ -209,9 +205,8 @@ UDQSet UDQUnaryElementalFunction::IDV(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::EXP(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
-            result.assign( index, std::exp(udq_value.get()) );
+        if (result.defined(index))
+            result.assign( index, std::exp(result.get(index)) );
     }
     return result;
 }
@@ -219,9 +214,8 @@ UDQSet UDQUnaryElementalFunction::EXP(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::NINT(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
-            result.assign( index, std::nearbyint(udq_value.get()) );
+        if (result.defined(index))
+            result.assign( index, std::nearbyint(result.get(index)) );
     }
     return result;
 }
@@ -231,8 +225,7 @@ UDQSet UDQUnaryElementalFunction::RANDN(std::mt19937& rng, const UDQSet& arg) {
     auto result = arg;
     std::normal_distribution<double> dist(0,1);
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
+        if (result.defined(index))
             result.assign( index, dist(rng) );
     }
     return result;
@@ -243,8 +236,7 @@ UDQSet UDQUnaryElementalFunction::RANDU(std::mt19937& rng, const UDQSet& arg) {
     auto result = arg;
     std::uniform_real_distribution<double> dist(-1,1);
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value)
+        if (result.defined(index))
             result.assign( index, dist(rng) );
     }
     return result;
@@ -257,9 +249,8 @@ UDQSet UDQUnaryElementalFunction::RANDU(std::mt19937& rng, const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::LN(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value) {
-            double elm = udq_value.get();
+        if (result.defined(index)) {
+            double elm = result.get(index);
             if (elm > 0)
                 result.assign(index, std::log(elm));
             else
@@ -273,9 +264,8 @@ UDQSet UDQUnaryElementalFunction::LN(const UDQSet& arg) {
 UDQSet UDQUnaryElementalFunction::LOG(const UDQSet& arg) {
     auto result = arg;
     for (std::size_t index=0; index < result.size(); index++) {
-        auto& udq_value = result[index];
-        if (udq_value) {
-            double elm = udq_value.get();
+        if (result.defined(index)) {
+            double elm = result.get(index);
             if (elm > 0)
                 result.assign(index, std::log10(elm));
             else
@@ -293,14 +283,12 @@ namespace {
 
         UDQSet result = arg1;
         for (std::size_t index = 0; index < result.size(); index++) {
-            const auto& elm1 = arg1[index];
-            const auto& elm2 = arg2[index];
-            if (elm1.defined() != elm2.defined()) {
-                if (elm1)
-                    result.assign(index, elm1.get());
-
-                if (elm2)
-                    result.assign(index, elm2.get());
+            if (arg1.defined(index) != arg2.defined(index)) {
+                if (arg1.defined(index))
+                    result.assign(index, arg1.get(index));
+
+                if (arg2.defined(index))
+                    result.assign(index, arg2.get(index));
             }
         }
         return result;
@@ -313,12 +301,11 @@ UDQSet UDQUnaryElementalFunction::SORT(const UDQSet& arg, bool ascending) {
     using sort_node = std::pair<std::size_t, double>;
     std::vector<sort_node> sort_nodes;
     for (std::size_t index = 0; index < arg.size(); index++) {
-        const auto& value = arg[index];
-        if (value.defined()) {
+        if (arg.defined(index)) {
             if (ascending)
-                sort_nodes.emplace_back(index,  value.get() );
+                sort_nodes.emplace_back(index,  arg.get(index) );
             else
-                sort_nodes.emplace_back(index, -value.get() );
+                sort_nodes.emplace_back(index, -arg.get(index) );
         }
     }
 
@@ -328,8 +315,7 @@ UDQSet UDQUnaryElementalFunction::SORT(const UDQSet& arg, bool ascending) {
     double sort_value = 1;
     for (const auto& node : sort_nodes) {
         const auto& index = node.first;
-        auto& value = result[index];
-        if (value.defined()) {
+        if (result.defined(index)) {
             result.assign(index, sort_value);
             sort_value += 1;
         }
@@ -363,13 +349,12 @@ UDQSet UDQBinaryFunction::LE(double eps, const UDQSet& lhs, const UDQSet& rhs) {
     auto rel_diff = result / lhs;
 
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm) {
-            const double abs_diff = elm.get();
+        if (result.defined(index)) {
+            const double abs_diff = result.get(index);
             if (abs_diff == 0)
                 result.assign(index, 1);
             else {
-                double diff = rel_diff[index].get();
+                double diff = rel_diff.get(index);
                 if (diff <= eps)
                     result.assign(index, 1);
                 else
@@ -385,13 +370,12 @@ UDQSet UDQBinaryFunction::GE(double eps, const UDQSet& lhs, const UDQSet& rhs) {
     auto rel_diff = result / lhs;
 
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm) {
-            const double abs_diff = elm.get();
+        if (result.defined(index)) {
+            const double abs_diff = result.get(index);
             if (abs_diff == 0)
                 result.assign(index, 1);
             else {
-                double diff = rel_diff[index].get();
+                double diff = rel_diff.get(index);
                 if (diff >= -eps)
                     result.assign(index, 1);
                 else
@@ -408,13 +392,12 @@ UDQSet UDQBinaryFunction::EQ(double eps, const UDQSet& lhs, const UDQSet& rhs) {
     auto rel_diff = result / lhs;
 
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm) {
-            const double abs_diff = elm.get();
+        if (result.defined(index)) {
+            const double abs_diff = result.get(index);
             if (abs_diff == 0)
                 result.assign(index, 1);
             else {
-                const double diff = std::fabs(rel_diff[index].get());
+                const double diff = std::fabs(rel_diff.get(index));
                 if (diff <= eps)
                     result.assign(index, 1);
                 else
@@ -429,9 +412,8 @@ UDQSet UDQBinaryFunction::EQ(double eps, const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::NE(double eps, const UDQSet& lhs, const UDQSet& rhs) {
     auto result = UDQBinaryFunction::EQ(eps, lhs, rhs);
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm)
-            result.assign(index, 1 - elm.get());
+        if (result.defined(index))
+            result.assign(index, 1 - result.get(index));
     }
     return result;
 }
@@ -441,9 +423,8 @@ UDQSet UDQBinaryFunction::GT(const UDQSet& lhs, const UDQSet& rhs) {
     auto result = lhs - rhs;
 
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm) {
-            double diff = elm.get();
+        if (result.defined(index)) {
+            double diff = result.get(index);
             if (diff > 0)
                 result.assign(index, 1);
             else
@@ -457,9 +438,8 @@ UDQSet UDQBinaryFunction::LT(const UDQSet& lhs, const UDQSet& rhs) {
     auto result = lhs - rhs;
 
     for (std::size_t index=0; index < result.size(); index++) {
-        auto elm = result[index];
-        if (elm) {
-            double diff = elm.get();
+        if (result.defined(index)) {
+            double diff = result.get(index);
             if (diff < 0)
                 result.assign(index, 1);
             else
@@ -478,11 +458,8 @@ UDQSet UDQBinaryFunction::ADD(const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::UADD(const UDQSet& lhs, const UDQSet& rhs) {
     UDQSet result = udq_union(lhs,rhs);
     for (std::size_t index=0; index < lhs.size(); index++) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm)
-            result.assign(index, rhs_elm.get() + lhs_elm.get());
+        if (lhs.defined(index) && rhs.defined(index))
+            result.assign(index, rhs.get(index) + lhs.get(index));
     }
     return result;
 }
@@ -490,11 +467,8 @@ UDQSet UDQBinaryFunction::UADD(const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::UMUL(const UDQSet& lhs, const UDQSet& rhs) {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index=0; index < lhs.size(); index++) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm)
-            result.assign(index, rhs_elm.get() * lhs_elm.get());
+        if (lhs.defined(index) && rhs.defined(index))
+            result.assign(index, rhs.get(index) * lhs.get(index));
     }
     return result;
 }
@@ -502,11 +476,8 @@ UDQSet UDQBinaryFunction::UMUL(const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::UMIN(const UDQSet& lhs, const UDQSet& rhs) {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index=0; index < lhs.size(); index++) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm)
-            result.assign(index, std::min(rhs_elm.get(), lhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index))
+            result.assign(index, std::min(rhs.get(index), lhs.get(index)));
     }
     return result;
 }
@@ -515,11 +486,8 @@ UDQSet UDQBinaryFunction::UMIN(const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::UMAX(const UDQSet& lhs, const UDQSet& rhs) {
     UDQSet result = udq_union(lhs, rhs);
     for (std::size_t index=0; index < lhs.size(); index++) {
-        const auto& lhs_elm = lhs[index];
-        const auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm)
-            result.assign(index, std::max(rhs_elm.get(), lhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index))
+            result.assign(index, std::max(rhs.get(index), lhs.get(index)));
     }
     return result;
 }
@@ -543,11 +511,8 @@ UDQSet UDQBinaryFunction::DIV(const UDQSet& lhs, const UDQSet& rhs) {
 UDQSet UDQBinaryFunction::POW(const UDQSet& lhs, const UDQSet& rhs) {
     UDQSet result = lhs;
     for (std::size_t index = 0; index < result.size(); index++) {
-        auto& lhs_elm = lhs[index];
-        auto& rhs_elm = rhs[index];
-
-        if (lhs_elm && rhs_elm)
-            result.assign(index, std::pow(lhs_elm.get(), rhs_elm.get()));
+        if (lhs.defined(index) && rhs.defined(index))
+            result.assign(index, std::pow(lhs.get(index), rhs.get(index)));
     }
     return result;
 }
@@ -0,0 +1,366 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace Opm {
+
+namespace {
+
+bool is_udq(const std::string& key) {
+    if (key.size() < 2)
+        return false;
+
+    if (key[1] != 'U')
+        return false;
+
+    return true;
+}
+
+bool has_wildcard(const std::string& pattern) {
+    return pattern.find('*') != std::string::npos;
+}
+
+/*
+  The in place arithmetic of the registers is only used when the operands
+  are combined without type promotion, see udq_cast() in UDQSet.cpp.
+*/
+bool compatible(const UDQSet& lhs, const UDQSet& rhs) {
+    return lhs.var_type() == rhs.var_type() || lhs.size() == rhs.size();
+}
+
+}
+
+
+UDQProgram::UDQProgram(const UDQASTNode& ast) {
+    this->compile(ast, 0);
+    this->registers.resize(this->num_registers);
+}
+
+
+std::size_t UDQProgram::size() const {
+    return this->code.size();
+}
+
+
+/*
+  Emits the instructions which evaluate node into register reg; the
+  right operand of a binary function is evaluated into register reg + 1.
+*/
+void UDQProgram::compile(const UDQASTNode& node, std::size_t reg) {
+    Instruction instruction{};
+    instruction.result = reg;
+    instruction.sign = node.sign;
+    this->num_registers = std::max(this->num_registers, reg + 1);
+
+    if (node.type == UDQTokenType::ecl_expr) {
+        const auto& keyword = std::get<std::string>(node.value);
+        instruction.keyword = keyword;
+        instruction.udq = is_udq(keyword);
+        if (!node.selector.empty())
+            instruction.selector = node.selector[0];
+
+        switch (UDQ::targetType(keyword)) {
+        case UDQVarType::WELL_VAR:
+            if (node.selector.empty())
+                instruction.op = OpCode::WellVar;
+            else if (has_wildcard(instruction.selector))
+                instruction.op = OpCode::WellVarPattern;
+            else
+                instruction.op = OpCode::WellVarSelected;
+            break;
+
+        case UDQVarType::GROUP_VAR:
+            if (node.selector.empty())
+                instruction.op = OpCode::GroupVar;
+            else if (has_wildcard(instruction.selector))
+                instruction.op = OpCode::GroupVarPattern;
+            else
+                instruction.op = OpCode::GroupVarSelected;
+            break;
+
+        case UDQVarType::FIELD_VAR:
+            instruction.op = OpCode::FieldVar;
+            break;
+
+        default:
+            instruction.op = OpCode::ScalarVar;
+        }
+    }
+    else if (UDQ::scalarFunc(node.type) || UDQ::elementalUnaryFunc(node.type)) {
+        this->compile(*node.left, reg);
+        instruction.op = UDQ::scalarFunc(node.type) ? OpCode::ScalarFunction : OpCode::UnaryFunction;
+        instruction.keyword = std::get<std::string>(node.value);
+    }
+    else if (UDQ::binaryFunc(node.type)) {
+        this->compile(*node.left, reg);
+        this->compile(*node.right, reg + 1);
+        instruction.keyword = std::get<std::string>(node.value);
+        switch (node.type) {
+        case UDQTokenType::binary_op_add:
+            instruction.op = OpCode::Add;
+            break;
+        case UDQTokenType::binary_op_sub:
+            instruction.op = OpCode::Sub;
+            break;
+        case UDQTokenType::binary_op_mul:
+            instruction.op = OpCode::Mul;
+            break;
+        case UDQTokenType::binary_op_div:
+            instruction.op = OpCode::Div;
+            break;
+        default:
+            instruction.op = OpCode::BinaryFunction;
+        }
+    }
+    else if (node.type == UDQTokenType::number) {
+        instruction.op = OpCode::Number;
+        instruction.value = std::get<double>(node.value);
+    }
+    else {
+        instruction.op = OpCode::Error;
+        instruction.keyword = "Should not be here ... this->type: " + std::to_string(static_cast<int>(node.type));
+    }
+
+    this->code.push_back(std::move(instruction));
+}
+
+
+const std::vector<SummaryState::Handle>&
+UDQProgram::handles(const Instruction& instruction, const std::vector<std::string>& names, bool wells, SummaryState& st) const {
+    auto& cache = instruction.handles;
+    if (cache.has_value() && cache->layout_id == st.layout_id() && cache->names == names)
+        return cache->handles;
+
+    // Registering new variables does not change the layout id; the handles
+    // stay valid until the SummaryState is copied or assigned to.
+    cache.emplace();
+    cache->layout_id = st.layout_id();
+    cache->names = names;
+    cache->handles.reserve(names.size());
+    for (const auto& name : names)
+        cache->handles.push_back(wells ? st.well_var_handle(name, instruction.keyword)
+                                       : st.group_var_handle(name, instruction.keyword));
+
+    return cache->handles;
+}
+
+
+UDQSet UDQProgram::load_well_var(const Instruction& instruction, const std::vector<std::string>& all_wells, const std::vector<std::string>& wells, const UDQContext& context) const {
+    auto res = UDQSet::wells(instruction.keyword, all_wells);
+    if (wells.empty())
+        return res;
+
+    if (instruction.udq) {
+        for (const auto& well : wells)
+            res.assign(well, context.get_well_var(well, instruction.keyword));
+        return res;
+    }
+
+    auto& st = context.summary();
+    if (!st.has_well_var(instruction.keyword))
+        throw std::logic_error(fmt::format("Summary well variable: {} not registered", instruction.keyword));
+
+    const auto& handles = this->handles(instruction, wells, true, st);
+    const bool positional = (&wells == &all_wells);
+    for (std::size_t index = 0; index < wells.size(); index++) {
+        if (!st.has(handles[index]))
+            continue;
+
+        if (positional)
+            res.assign(index, st.get(handles[index]));
+        else
+            res.assign(wells[index], st.get(handles[index]));
+    }
+    return res;
+}
+
+
+UDQSet UDQProgram::load_group_var(const Instruction& instruction, const std::vector<std::string>& groups, const UDQContext& context) const {
+    auto res = UDQSet::groups(instruction.keyword, groups);
+    if (groups.empty())
+        return res;
+
+    if (instruction.udq) {
+        for (const auto& group : groups)
+            res.assign(group, context.get_group_var(group, instruction.keyword));
+        return res;
+    }
+
+    auto& st = context.summary();
+    if (!st.has_group_var(instruction.keyword))
+        throw std::logic_error(fmt::format("Summary group variable: {} not registered", instruction.keyword));
+
+    const auto& handles = this->handles(instruction, groups, false, st);
+    for (std::size_t index = 0; index < groups.size(); index++) {
+        if (st.has(handles[index]))
+            res.assign(index, st.get(handles[index]));
+    }
+    return res;
+}
+
+
+void UDQProgram::execute(const Instruction& instruction, UDQVarType target_type, const UDQContext& context) const {
+    auto& result = this->registers[instruction.result];
+    const auto& udqft = context.function_table();
+
+    switch (instruction.op) {
+    case OpCode::WellVar: {
+        const auto wells = context.wells();
+        result = this->load_well_var(instruction, wells, wells, context);
+        break;
+    }
+
+    case OpCode::WellVarPattern:
+        /*
+          The result set is defined for the wells matching the pattern, and
+          undefined for the remaining wells.
+        */
+        result = this->load_well_var(instruction, context.wells(), context.wells(instruction.selector), context);
+        break;
+
+    case OpCode::WellVarSelected:
+        // A fully qualified well name evaluates to a scalar.
+        result = UDQSet::scalar(instruction.keyword, context.get_well_var(instruction.selector, instruction.keyword));
+        break;
+
+    case OpCode::GroupVar:
+        result = this->load_group_var(instruction, context.groups(), context);
+        break;
+
+    case OpCode::GroupVarSelected:
+        result = UDQSet::scalar(instruction.keyword, context.get_group_var(instruction.selector, instruction.keyword));
+        // The tree evaluation does not apply the sign to a selected group
+        // variable.
+        return;
+
+    case OpCode::GroupVarPattern:
+        throw std::logic_error("Group names with wildcards is not yet supported");
+
+    case OpCode::FieldVar:
+        result = UDQSet::scalar(instruction.keyword, context.get(instruction.keyword));
+        break;
+
+    case OpCode::ScalarVar: {
+        const auto scalar = context.get(instruction.keyword);
+        if (!scalar.has_value())
+            throw std::logic_error("Should not be here: var_type: " + UDQ::typeName(UDQ::targetType(instruction.keyword)) + " stringvalue:" + instruction.keyword);
+
+        result = UDQSet::scalar(instruction.keyword, scalar.value());
+        break;
+    }
+
+    case OpCode::Number: {
+        const std::string dummy_name = "DUMMY";
+        switch (target_type) {
+        case UDQVarType::WELL_VAR:
+            result = UDQSet::wells(dummy_name, context.wells(), instruction.value);
+            break;
+        case UDQVarType::GROUP_VAR:
+            result = UDQSet::groups(dummy_name, context.groups(), instruction.value);
+            break;
+        case UDQVarType::SCALAR:
+            result = UDQSet::scalar(dummy_name, instruction.value);
+            break;
+        case UDQVarType::FIELD_VAR:
+            result = UDQSet::field(dummy_name, instruction.value);
+            break;
+        default:
+            throw std::invalid_argument("Unsupported target_type: " + std::to_string(static_cast<int>(target_type)));
+        }
+        break;
+    }
+
+    case OpCode::ScalarFunction: {
+        const auto& func = dynamic_cast<const UDQScalarFunction&>(udqft.get(instruction.keyword));
+        result = func.eval(*result);
+        break;
+    }
+
+    case OpCode::UnaryFunction: {
+        const auto& func = dynamic_cast<const UDQUnaryElementalFunction&>(udqft.get(instruction.keyword));
+        result = func.eval(*result);
+        break;
+    }
+
+    case OpCode::Add:
+    case OpCode::Sub:
+    case OpCode::Mul:
+    case OpCode::Div:
+    case OpCode::BinaryFunction: {
+        const auto& rhs = *this->registers[instruction.result + 1];
+        if (instruction.op != OpCode::BinaryFunction && compatible(*result, rhs)) {
+            if (instruction.op == OpCode::Add)
+                *result += rhs;
+            else if (instruction.op == OpCode::Sub)
+                *result -= rhs;
+            else if (instruction.op == OpCode::Mul)
+                *result *= rhs;
+            else
+                *result /= rhs;
+        } else {
+            const auto& func = dynamic_cast<const UDQBinaryFunction&>(udqft.get(instruction.keyword));
+            result = func.eval(*result, rhs);
+        }
+        break;
+    }
+
+    case OpCode::Error:
+        throw std::invalid_argument(instruction.keyword);
+    }
+
+    if (instruction.sign != 1.0)
+        *result *= instruction.sign;
+}
+
+
+void UDQProgram::bind(const UDQContext& context) const {
+    auto& st = context.summary();
+    for (const auto& instruction : this->code) {
+        if (instruction.udq)
+            continue;
+
+        if (instruction.op == OpCode::WellVar)
+            this->handles(instruction, context.wells(), true, st);
+        else if (instruction.op == OpCode::WellVarPattern)
+            this->handles(instruction, context.wells(instruction.selector), true, st);
+        else if (instruction.op == OpCode::GroupVar)
+            this->handles(instruction, context.groups(), false, st);
+    }
+}
+
+
+UDQSet UDQProgram::eval(UDQVarType target_type, const UDQContext& context) const {
+    for (const auto& instruction : this->code)
+        this->execute(instruction, target_type, context);
+
+    return std::move(*this->registers[0]);
+}
+
+}
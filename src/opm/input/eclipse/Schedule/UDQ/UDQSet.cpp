@@ -18,6 +18,7 @@
 */
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <fmt/format.h>
 
 #include <opm/common/utility/shmatch.hpp>
@@ -153,6 +154,91 @@ bool UDQScalar::operator==(const UDQScalar& other) const {
 }
 
 
+namespace {
+
+/*
+  Patterns without any of the special characters of shmatch() only match
+  the identical name, and can be looked up directly in the name index.
+*/
+bool is_pattern(const std::string& wgname) {
+    return wgname.find_first_of("*?[\\") != std::string::npos;
+}
+
+}
+
+UDQSet::const_iterator::const_iterator(const UDQSet* udq_set_arg, std::size_t index_arg) :
+    udq_set(udq_set_arg),
+    index(index_arg)
+{}
+
+UDQScalar UDQSet::const_iterator::operator*() const {
+    return (*this->udq_set)[this->index];
+}
+
+UDQSet::const_iterator& UDQSet::const_iterator::operator++() {
+    this->index += 1;
+    return *this;
+}
+
+UDQSet::const_iterator UDQSet::const_iterator::operator++(int) {
+    auto iter = *this;
+    this->index += 1;
+    return iter;
+}
+
+bool UDQSet::const_iterator::operator==(const const_iterator& other) const {
+    return this->udq_set == other.udq_set && this->index == other.index;
+}
+
+bool UDQSet::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
+}
+
+
+/*
+  The sets created during UDQ evaluation use the same few lists of well and
+  group names over and over again, the most recently used name indices are
+  therefore kept and reused when a set with the same names is created.
+*/
+std::shared_ptr<const UDQSet::NameIndex> UDQSet::make_index(const std::vector<std::string>& wgnames) {
+    constexpr std::size_t max_recent = 4;
+    thread_local std::vector<std::shared_ptr<const NameIndex>> recent;
+
+    auto iter = std::find_if(recent.begin(), recent.end(), [&wgnames](const auto& index) { return index->names == wgnames; });
+    if (iter != recent.end()) {
+        std::rotate(recent.begin(), iter, iter + 1);
+        return recent.front();
+    }
+
+    auto index = std::make_shared<NameIndex>();
+    index->names = wgnames;
+    index->lookup.reserve(wgnames.size());
+    for (std::size_t pos = 0; pos < wgnames.size(); pos++)
+        index->lookup.emplace(wgnames[pos], pos);
+
+    if (recent.size() == max_recent)
+        recent.pop_back();
+    recent.insert(recent.begin(), index);
+    return index;
+}
+
+std::optional<std::size_t> UDQSet::find(const std::string& wgname) const {
+    auto iter = this->m_index->lookup.find(wgname);
+    if (iter == this->m_index->lookup.end())
+        return std::nullopt;
+
+    return iter->second;
+}
+
+void UDQSet::set(std::size_t index, double value) {
+    if (std::isfinite(value)) {
+        this->m_values[index] = value;
+        this->m_defined[index] = 1;
+    } else
+        this->m_defined[index] = 0;
+}
+
+
 const std::string& UDQSet::name() const {
     return this->m_name;
 }
@@ -163,30 +249,26 @@ void UDQSet::name(const std::string& name) {
 
 UDQSet::UDQSet(const std::string& name, UDQVarType var_type, const std::vector<std::string>& wgnames) :
     m_name(name),
-    m_var_type(var_type)
+    m_var_type(var_type),
+    m_index(make_index(wgnames)),
+    m_values(wgnames.size(), 0),
+    m_defined(wgnames.size(), 0)
 {
-    for (const auto& wgname : wgnames)
-        this->values.emplace_back(wgname);
 }
 
 UDQSet::UDQSet(const std::string& name, UDQVarType var_type) :
-    m_name(name),
-    m_var_type(var_type)
+    UDQSet(name, var_type, 1)
 {
-    this->values.resize(1);
 }
 
 UDQSet::UDQSet(const std::string& name, UDQVarType var_type, std::size_t size) :
-    m_name(name),
-    m_var_type(var_type)
+    UDQSet(name, var_type, std::vector<std::string>(size))
 {
-    this->values.resize(size);
 }
 
 UDQSet::UDQSet(const std::string& name, std::size_t size) :
-    m_name(name)
+    UDQSet(name, UDQVarType::NONE, size)
 {
-    this->values.resize(size);
 }
 
 UDQSet UDQSet::scalar(const std::string& name, double scalar_value)
@@ -241,23 +323,35 @@ UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& g
 
 
 bool UDQSet::has(const std::string& name) const {
-    for (const auto& res : this->values) {
-        if (res.wgname() == name)
-            return true;
-    }
-    return false;
+    return this->find(name).has_value();
 }
 
 std::size_t UDQSet::size() const {
-    return this->values.size();
+    return this->m_values.size();
 }
 
 
-void UDQSet::assign(const std::string& wgname, double value) {
+void UDQSet::assign_matching(const std::string& wgname, const std::optional<double>& value) {
+    if (!is_pattern(wgname)) {
+        const auto index = this->find(wgname);
+        if (!index.has_value())
+            throw std::out_of_range("No well/group matching: " + wgname);
+
+        if (value.has_value())
+            this->set(*index, *value);
+        else
+            this->m_defined[*index] = 0;
+        return;
+    }
+
     bool assigned = false;
-    for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
-            udq_value.assign( value );
+    const ShellPattern pattern(wgname);
+    for (std::size_t index = 0; index < this->size(); index++) {
+        if (pattern.match(this->m_index->names[index])) {
+            if (value.has_value())
+                this->set(index, *value);
+            else
+                this->m_defined[index] = 0;
             assigned = true;
         }
     }
@@ -265,31 +359,31 @@ void UDQSet::assign(const std::string& wgname, double value) {
         throw std::out_of_range("No well/group matching: " + wgname);
 }
 
+void UDQSet::assign(const std::string& wgname, double value) {
+    this->assign_matching(wgname, value);
+}
+
 void UDQSet::assign(const std::string& wgname, const std::optional<double>& value) {
-    bool assigned = false;
-    for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
-            udq_value.assign( value );
-            assigned = true;
-        }
-    }
-    if (!assigned)
-        throw std::out_of_range("No well/group matching: " + wgname);
+    this->assign_matching(wgname, value);
 }
 
 void UDQSet::assign(double value) {
-    for (auto& v : this->values)
-        v.assign(value);
+    if (std::isfinite(value)) {
+        std::fill(this->m_values.begin(), this->m_values.end(), value);
+        std::fill(this->m_defined.begin(), this->m_defined.end(), 1);
+    } else
+        std::fill(this->m_defined.begin(), this->m_defined.end(), 0);
 }
 
 void UDQSet::assign(const std::optional<double>& value) {
-    for (auto& v : this->values)
-        v.assign(value);
+    if (value.has_value())
+        this->assign(*value);
+    else
+        std::fill(this->m_defined.begin(), this->m_defined.end(), 0);
 }
 
 void UDQSet::assign(std::size_t index, double value) {
-    auto& scalar = this->values[index];
-    scalar.assign(value);
+    this->set(index, value);
 }
 
 
@@ -298,26 +392,66 @@ UDQVarType UDQSet::var_type() const {
 }
 
 std::vector<std::string> UDQSet::wgnames() const {
-    std::vector<std::string> names;
-    for (const auto& value : this->values)
-        names.push_back(value.wgname());
-    return names;
+    return this->m_index->names;
 }
 
 /************************************************************************/
 
+/*
+  The elementwise operations are written as branch free loops over the
+  value and defined arrays to allow the compiler to vectorize them. The
+  result of an operation is only defined if all the operands are defined,
+  and the result is finite.
+*/
+
+namespace {
+
+template <typename Op>
+void combine(std::vector<double>& values, std::vector<char>& defined,
+             const std::vector<double>& rhs_values, const std::vector<char>& rhs_defined,
+             Op op)
+{
+    const std::size_t size = values.size();
+    double* v = values.data();
+    char* d = defined.data();
+    const double* rv = rhs_values.data();
+    const char* rd = rhs_defined.data();
+
+    for (std::size_t index = 0; index < size; index++) {
+        const double result = op(v[index], rv[index]);
+        const bool def = d[index] && rd[index] && std::isfinite(result);
+        v[index] = def ? result : v[index];
+        d[index] = def;
+    }
+}
+
+template <typename Op>
+void combine(std::vector<double>& values, std::vector<char>& defined, double rhs, Op op)
+{
+    const std::size_t size = values.size();
+    double* v = values.data();
+    char* d = defined.data();
+
+    for (std::size_t index = 0; index < size; index++) {
+        const double result = op(v[index], rhs);
+        const bool def = d[index] && std::isfinite(result);
+        v[index] = def ? result : v[index];
+        d[index] = def;
+    }
+}
+
+}
+
 
 void UDQSet::operator+=(const UDQSet& rhs) {
     if (this->size() != rhs.size())
         throw std::logic_error("Incompatible size in UDQSet operator+");
 
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] += rhs[index];
+    combine(this->m_values, this->m_defined, rhs.m_values, rhs.m_defined, std::plus<double>{});
 }
 
 void UDQSet::operator+=(double rhs) {
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] += rhs;
+    combine(this->m_values, this->m_defined, rhs, std::plus<double>{});
 }
 
 void UDQSet::operator-=(double rhs) {
@@ -325,7 +459,10 @@ void UDQSet::operator-=(double rhs) {
 }
 
 void UDQSet::operator-=(const UDQSet& rhs) {
-    *(this) += (rhs * -1.0);
+    if (this->size() != rhs.size())
+        throw std::logic_error("Incompatible size in UDQSet operator-");
+
+    combine(this->m_values, this->m_defined, rhs.m_values, rhs.m_defined, std::minus<double>{});
 }
 
 
@@ -333,68 +470,79 @@ void UDQSet::operator*=(const UDQSet& rhs) {
     if (this->size() != rhs.size())
         throw std::logic_error("Incompatible size  UDQSet operator*");
 
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] *= rhs[index];
+    combine(this->m_values, this->m_defined, rhs.m_values, rhs.m_defined, std::multiplies<double>{});
 }
 
 void UDQSet::operator*=(double rhs) {
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] *= rhs;
+    combine(this->m_values, this->m_defined, rhs, std::multiplies<double>{});
 }
 
 void UDQSet::operator/=(const UDQSet& rhs) {
     if (this->size() != rhs.size())
         throw std::logic_error("Incompatible size  UDQSet operator/");
 
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] /= rhs[index];
+    combine(this->m_values, this->m_defined, rhs.m_values, rhs.m_defined, std::divides<double>{});
 }
 
 void UDQSet::operator/=(double rhs) {
-    for (std::size_t index = 0; index < this->size(); index++)
-        this->values[index] /= rhs;
+    combine(this->m_values, this->m_defined, rhs, std::divides<double>{});
 }
 
 
 std::vector<double> UDQSet::defined_values() const {
     std::vector<double> dv;
-    for (const auto& v : this->values) {
-        if (v)
-            dv.push_back(v.get());
+    dv.reserve(this->size());
+    for (std::size_t index = 0; index < this->size(); index++) {
+        if (this->m_defined[index])
+            dv.push_back(this->m_values[index]);
     }
     return dv;
 }
 
 
 std::size_t UDQSet::defined_size() const {
-    std::size_t dsize = 0;
-    for (const auto& v : this->values) {
-        if (v)
-            dsize += 1;
-    }
-    return dsize;
+    return std::count(this->m_defined.begin(), this->m_defined.end(), 1);
+}
+
+bool UDQSet::defined(std::size_t index) const {
+    return this->m_defined.at(index);
+}
+
+double UDQSet::get(std::size_t index) const {
+    if (!this->defined(index))
+        throw std::invalid_argument("UDQSCalar: Value not defined  wgname: " + this->wgname(index));
+
+    return this->m_values[index];
 }
 
-const UDQScalar& UDQSet::operator[](std::size_t index) const {
+const std::string& UDQSet::wgname(std::size_t index) const {
+    return this->m_index->names.at(index);
+}
+
+UDQScalar UDQSet::operator[](std::size_t index) const {
     if (index >= this->size())
         throw std::out_of_range("Index out of range in UDQset::operator[]");
-    return this->values[index];
+
+    UDQScalar scalar(this->m_index->names[index]);
+    if (this->m_defined[index])
+        scalar.m_value = this->m_values[index];
+    return scalar;
 }
 
-const UDQScalar& UDQSet::operator[](const std::string& wgname) const {
-    auto value_iter = std::find_if( this->values.begin(), this->values.end(), [&wgname](const UDQScalar& value) { return (value.wgname() == wgname );});
-    if (value_iter == this->values.end())
+UDQScalar UDQSet::operator[](const std::string& wgname) const {
+    const auto index = this->find(wgname);
+    if (!index.has_value())
         throw std::out_of_range("No such well/group: " + wgname);
-    return *value_iter;
+    return (*this)[*index];
 }
 
 
-std::vector<UDQScalar>::const_iterator UDQSet::begin() const {
-    return this->values.begin();
+UDQSet::const_iterator UDQSet::begin() const {
+    return const_iterator(this, 0);
 }
 
-std::vector<UDQScalar>::const_iterator UDQSet::end() const {
-    return this->values.end();
+UDQSet::const_iterator UDQSet::end() const {
+    return const_iterator(this, this->size());
 }
 
 /*****************************************************************/
@@ -519,8 +667,8 @@ std::pair<UDQSet, UDQSet> udq_cast(const UDQSet& lhs, const UDQSet& rhs)
     }
 
     auto msg = fmt::format("Type/size mismatch when combining UDQs {}(size={}, type={}) and {}(size={}, type={})",
-                           lhs.name(), lhs.size(), lhs.var_type(),
-                           rhs.name(), rhs.size(), rhs.var_type());
+                           lhs.name(), lhs.size(), UDQ::typeName(lhs.var_type()),
+                           rhs.name(), rhs.size(), UDQ::typeName(rhs.var_type()));
     throw std::logic_error(msg);
 }
 
@@ -595,17 +743,29 @@ UDQSet operator/(const UDQSet&lhs, double rhs) {
 UDQSet operator/(double lhs, const UDQSet&rhs) {
     UDQSet result = rhs;
     for (std::size_t index = 0; index < rhs.size(); index++) {
-        const auto& elm = rhs[index];
-        if (elm)
-            result.assign(index, lhs / elm.get());
+        if (rhs.defined(index))
+            result.assign(index, lhs / rhs.get(index));
     }
     return result;
 }
 
 bool UDQSet::operator==(const UDQSet& other) const {
-    return this->m_name == other.m_name &&
-           this->m_var_type == other.m_var_type &&
-           this->values == other.values;
+    if (this->m_name != other.m_name ||
+        this->m_var_type != other.m_var_type ||
+        this->size() != other.size())
+        return false;
+
+    if (this->m_index != other.m_index && this->m_index->names != other.m_index->names)
+        return false;
+
+    for (std::size_t index = 0; index < this->size(); index++) {
+        if (this->m_defined[index] != other.m_defined[index])
+            return false;
+
+        if (this->m_defined[index] && this->m_values[index] != other.m_values[index])
+            return false;
+    }
+    return true;
 }
 
 UDQSet UDQSet::deserialize(Serializer& ser)
@@ -614,10 +774,17 @@ UDQSet UDQSet::deserialize(Serializer& ser)
     auto var_type = ser.get<UDQVarType>();
     auto size = ser.get<std::size_t>();
 
-    UDQSet udq_set(name, var_type, size);
+    std::vector<UDQScalar> scalars;
+    std::vector<std::string> wgnames;
+    for (std::size_t index = 0; index < size; index++) {
+        scalars.push_back(UDQScalar::deserialize(ser));
+        wgnames.push_back(scalars.back().wgname());
+    }
+
+    UDQSet udq_set(name, var_type, wgnames);
     for (std::size_t index = 0; index < size; index++) {
-        auto value = UDQScalar::deserialize(ser);
-        udq_set.values[index] = std::move(value);
+        if (scalars[index].defined())
+            udq_set.set(index, scalars[index].get());
     }
     return udq_set;
 }
@@ -626,10 +793,10 @@ UDQSet UDQSet::deserialize(Serializer& ser)
 void UDQSet::serialize(Serializer& ser) const {
     ser.put<std::string>(this->m_name);
     ser.put<UDQVarType>(this->m_var_type);
-    ser.put<std::size_t>(this->values.size());
+    ser.put<std::size_t>(this->size());
 
-    for (const auto& value : this->values)
-        value.serialize(ser);
+    for (std::size_t index = 0; index < this->size(); index++)
+        (*this)[index].serialize(ser);
 }
 
 
@@ -21,6 +21,7 @@
 #include <stdexcept>
 
 #include <opm/common/utility/Serializer.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/io/eclipse/rst/state.hpp>
 
@@ -48,23 +49,33 @@ bool has_var(const std::unordered_map<std::string, std::unordered_map<std::strin
     return res_iter->second.count(wgname);
 }
 
-void add_results(std::unordered_map<std::string, std::unordered_map<std::string, double>>& values,
+/*
+  Returns true if any of the stored values were changed.
+*/
+bool add_results(std::unordered_map<std::string, std::unordered_map<std::string, double>>& values,
                  const std::string& udq_key,
                  const UDQSet& result) {
 
-    auto& udq_values = values[udq_key];
+    auto [values_iter, changed] = values.try_emplace(udq_key);
+    auto& udq_values = values_iter->second;
     for (const auto& res1 : result) {
         auto iter = udq_values.find(res1.wgname());
         if (iter == udq_values.end()) {
-            if (res1.defined())
+            if (res1.defined()) {
                 udq_values.emplace( res1.wgname(), res1.get() );
+                changed = true;
+            }
         } else {
-            if (res1.defined())
+            if (res1.defined()) {
+                changed |= (iter->second != res1.get());
                 iter->second = res1.get();
-            else
+            } else {
                 udq_values.erase(iter);
+                changed = true;
+            }
         }
     }
+    return changed;
 }
 
 double get_scalar(const std::unordered_map<std::string, double>& values,
@@ -96,6 +107,7 @@ double get_wg(const std::unordered_map<std::string, std::unordered_map<std::stri
 }
 
 void UDQState::load_rst(const RestartIO::RstState& rst_state) {
+    this->eval_cache.reset();
     for (const auto& udq : rst_state.udqs) {
         if (udq.is_define()) {
             if (udq.var_type == UDQVarType::WELL_VAR) {
@@ -157,24 +169,55 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result) {
     if (!is_udq(udq_key))
         throw std::logic_error("Key is not a UDQ variable:" + udq_key);
 
+    bool changed = false;
     auto var_type = result.var_type();
     if (var_type == UDQVarType::WELL_VAR)
-        add_results(this->well_values, udq_key, result);
+        changed = add_results(this->well_values, udq_key, result);
     else if (var_type == UDQVarType::GROUP_VAR)
-        add_results(this->group_values, udq_key, result);
+        changed = add_results(this->group_values, udq_key, result);
     else {
         auto scalar = result[0];
         auto iter = this->scalar_values.find(udq_key);
         if (iter == this->scalar_values.end()) {
-            if (scalar.defined())
+            if (scalar.defined()) {
                 this->scalar_values.emplace(udq_key, scalar.get());
+                changed = true;
+            }
         } else {
-            if (scalar.defined())
+            if (scalar.defined()) {
+                changed = (iter->second != scalar.get());
                 iter->second = scalar.get();
-            else
+            } else {
                 this->scalar_values.erase(iter);
+                changed = true;
+            }
         }
     }
+
+    if (changed)
+        this->versions[udq_key] = ++this->m_version;
+}
+
+
+std::size_t UDQState::version(const std::string& udq_key) const {
+    auto iter = this->versions.find(udq_key);
+    if (iter == this->versions.end())
+        return 0;
+
+    return iter->second;
+}
+
+
+std::unordered_map<std::string, UDQState::DefineRecord>&
+UDQState::define_records(std::size_t report_step, const SummaryState& st, const std::vector<std::string>& wells) {
+    if (!this->eval_cache.has_value() ||
+        this->eval_cache->report_step != report_step ||
+        this->eval_cache->summary_layout != st.layout_id() ||
+        this->eval_cache->summary_names != st.names_version() ||
+        this->eval_cache->wells != wells)
+        this->eval_cache = EvalCache{report_step, st.layout_id(), st.names_version(), wells, {}};
+
+    return this->eval_cache->defines;
 }
 
 
@@ -264,6 +307,7 @@ std::vector<char> UDQState::serialize() const {
 
 void UDQState::deserialize(const std::vector<char>& buffer) {
     Serializer ser(buffer);
+    this->eval_cache.reset();
     this->undef_value = ser.get<double>();
 
     this->well_values.clear();
@@ -180,10 +180,9 @@ namespace Opm {
             return { wlist.wells() };
         } else {
             std::vector<std::string> well_set;
-            auto pattern = wlist_pattern.substr(1);
+            const ShellPattern pattern(wlist_pattern.substr(1));
             for (const auto& [name, wlist] : this->wlists) {
-                auto wlist_name = name.substr(1);
-                if (shmatch(pattern, wlist_name)) {
+                if (pattern.match(std::string_view(name).substr(1))) {
                     const auto& well_names = wlist.wells();
                     for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
                        if (std::count(well_set.begin(), well_set.end(), *it) == 0)
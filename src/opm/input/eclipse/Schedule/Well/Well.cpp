@@ -165,6 +165,12 @@ const static Well::WellGuideRate def_guide_rate = {true, -1, Well::GuideRateTarg
 const static bool def_automatic_shutin = true;
 constexpr double def_solvent_fraction = 0;
 
+template <typename T>
+void share_equal(std::shared_ptr<T>& ptr, const std::shared_ptr<T>& other) {
+    if (ptr && other && (ptr != other) && (*ptr == *other))
+        ptr = other;
+}
+
 }
 
 Well::Well(const RestartIO::RstWell& rst_well,
@@ -182,7 +188,7 @@ Well::Well(const RestartIO::RstWell& rst_well,
     allow_cross_flow(rst_well.allow_xflow == 1),
     automatic_shutin(def_automatic_shutin),
     pvt_table(rst_well.pvt_table),
-    unit_system(unit_system_arg),
+    unit_system(std::make_shared<UnitSystem>(unit_system_arg)),
     udq_undefined(udq_undefined_arg),
     wtype(rst_well.wtype),
     guide_rate(def_guide_rate),
@@ -201,7 +207,7 @@ Well::Well(const RestartIO::RstWell& rst_well,
     status(status_from_int(rst_well.well_status))
 {
     if (this->wtype.producer()) {
-        auto p = std::make_shared<WellProductionProperties>(this->unit_system, wname);
+        auto p = std::make_shared<WellProductionProperties>(*this->unit_system, wname);
         // Reverse of function ctrlMode() in AggregateWellData.cpp
         p->whistctl_cmode = def_whistctl_cmode;
         p->BHPTarget.update(rst_well.bhp_target_float);
@@ -253,7 +259,7 @@ Well::Well(const RestartIO::RstWell& rst_well,
         this->updateProduction(std::move(p));
     }
     else {
-        auto i = std::make_shared<WellInjectionProperties>(this->unit_system, wname);
+        auto i = std::make_shared<WellInjectionProperties>(*this->unit_system, wname);
         i->VFPTableNumber = rst_well.vfp_table;
         i->predictionMode = this->prediction_mode;
 
@@ -359,7 +365,7 @@ Well::Well(const std::string& wname_arg,
     automatic_shutin(auto_shutin),
     pvt_table(pvt_table_),
     gas_inflow(inflow_eq),
-    unit_system(unit_system_arg),
+    unit_system(std::make_shared<UnitSystem>(unit_system_arg)),
     udq_undefined(udq_undefined_arg),
     wtype(wtype_arg),
     guide_rate({true, -1, Well::GuideRateTarget::UNDEFINED,ParserKeywords::WGRUPCON::SCALING_FACTOR::defaultValue}),
@@ -372,11 +378,11 @@ Well::Well(const std::string& wname_arg,
     brine_properties(std::make_shared<WellBrineProperties>()),
     tracer_properties(std::make_shared<WellTracerProperties>()),
     connections(std::make_shared<WellConnections>(ordering_arg, headI, headJ)),
-    production(std::make_shared<WellProductionProperties>(unit_system, wname)),
-    injection(std::make_shared<WellInjectionProperties>(unit_system, wname)),
+    production(std::make_shared<WellProductionProperties>(unit_system_arg, wname)),
+    injection(std::make_shared<WellInjectionProperties>(unit_system_arg, wname)),
     status(Status::SHUT)
 {
-    auto p = std::make_shared<WellProductionProperties>(this->unit_system, this->wname);
+    auto p = std::make_shared<WellProductionProperties>(*this->unit_system, this->wname);
     p->whistctl_cmode = whistctl_cmode;
     this->updateProduction(p);
 }
@@ -391,7 +397,7 @@ Well Well::serializeObject()
     result.headI = 3;
     result.headJ = 4;
     result.ref_depth = 5;
-    result.unit_system = UnitSystem::serializeObject();
+    result.unit_system = std::make_shared<UnitSystem>(UnitSystem::serializeObject());
     result.udq_undefined = 6.0;
     result.status = Status::AUTO;
     result.drainage_radius = 7.0;
@@ -899,6 +905,26 @@ bool Well::hasSameConnectionsPointers(const Well& other) const
     return this->connections == other.connections;
 }
 
+void Well::shareProperties(const Well& other)
+{
+    share_equal(this->unit_system, other.unit_system);
+    share_equal(this->econ_limits, other.econ_limits);
+    share_equal(this->foam_properties, other.foam_properties);
+    share_equal(this->polymer_properties, other.polymer_properties);
+    share_equal(this->micp_properties, other.micp_properties);
+    share_equal(this->brine_properties, other.brine_properties);
+    share_equal(this->tracer_properties, other.tracer_properties);
+    share_equal(this->connections, other.connections);
+    share_equal(this->production, other.production);
+    share_equal(this->injection, other.injection);
+    share_equal(this->segments, other.segments);
+}
+
+const UnitSystem& Well::units() const
+{
+    return *this->unit_system;
+}
+
 void Well::setInsertIndex(std::size_t index) {
     this->insert_index = index;
 }
@@ -911,11 +937,11 @@ double Well::convertDeckPI(double deckPI) const {
     //      not provide that enumerator.
     switch (this->getPreferredPhase()) {
     case Phase::GAS:
-        return this->unit_system.to_si(M::gas_productivity_index, deckPI);
+        return this->unit_system->to_si(M::gas_productivity_index, deckPI);
 
     case Phase::OIL:
     case Phase::WATER:
-        return this->unit_system.to_si(M::liquid_productivity_index, deckPI);
+        return this->unit_system->to_si(M::liquid_productivity_index, deckPI);
 
     default:
         throw std::invalid_argument {
@@ -1360,7 +1386,7 @@ Well::ProductionControls Well::productionControls(const SummaryState& st) const
 
 Well::InjectionControls Well::injectionControls(const SummaryState& st) const {
     if (!this->isProducer()) {
-        auto controls = this->injection->controls(this->unit_system, st, this->udq_undefined);
+        auto controls = this->injection->controls(*this->unit_system, st, this->udq_undefined);
         controls.prediction_mode = this->predictionMode();
         return controls;
     } else
@@ -1645,7 +1671,7 @@ bool Well::cmp_structure(const Well& other) const {
         && (this->hasRefDepth() == other.hasRefDepth())
         && (!this->hasRefDepth() || (this->getRefDepth() == other.getRefDepth()))
         && (this->getPreferredPhase() == other.getPreferredPhase())
-        && (this->unit_system == other.unit_system)
+        && (this->units() == other.units())
         && (this->udq_undefined == other.udq_undefined)
         && (this->getConnections() == other.getConnections())
         && (this->getDrainageRadius() == other.getDrainageRadius())
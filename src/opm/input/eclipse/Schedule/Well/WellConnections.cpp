@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
@@ -124,6 +125,16 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
     }
 
 
+    // The key is only used to find a candidate position, the coordinates
+    // are always compared with the connection itself.
+    std::uint64_t ijk_key(const int i, const int j, const int k)
+    {
+        const auto mask = (std::uint64_t{1} << 21) - 1;
+        return ((static_cast<std::uint64_t>(i) & mask) << 42)
+            |  ((static_cast<std::uint64_t>(j) & mask) << 21)
+            |   (static_cast<std::uint64_t>(k) & mask);
+    }
+
 } // anonymous namespace
 
     WellConnections::WellConnections() :
@@ -148,6 +159,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
         headJ(headJArg),
         m_connections(connections)
     {
+        this->rebuildIndex();
     }
 
 
@@ -158,6 +170,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
         result.headI = 1;
         result.headJ = 2;
         result.m_connections = {Connection::serializeObject()};
+        result.rebuildIndex();
 
         return result;
     }
@@ -329,10 +342,6 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
             if (defaultSatTable)
                 satTableId = props->satnum;
 
-            auto same_ijk = [&]( const Connection& c ) {
-                return c.sameCoordinate( I,J,k );
-            };
-
             if (r0Item.hasValue(0))
                 r0 = r0Item.getSIDouble(0);
 
@@ -385,10 +394,8 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
             double re = std::sqrt(D[0] * D[1] / angle * 2); // area equivalent radius of the grid block
             double connection_length = D[2];            // the length of the well perforation
 
-            auto prev = std::find_if( this->m_connections.begin(),
-                                      this->m_connections.end(),
-                                      same_ijk );
-            if (prev == this->m_connections.end()) {
+            const auto prev_pos = this->findIJK(I, J, k);
+            if (!prev_pos.has_value()) {
                 std::size_t noConn = this->m_connections.size();
                 this->addConnection(I,J,k,
                                     cell.global_index,
@@ -407,6 +414,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
                                     noConn,
                                     defaultSatTable);
             } else {
+                auto prev = this->m_connections.begin() + *prev_pos;
                 std::size_t css_ind = prev->sort_value();
                 int conSegNo = prev->segment();
                 const auto& perf_range = prev->perf_range();
@@ -476,45 +484,98 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
     }
 
 
-    bool WellConnections::hasGlobalIndex(std::size_t global_index) const {
-        auto conn_iter = std::find_if(this->begin(), this->end(),
-                                      [global_index] (const Connection& conn) {return conn.global_index() == global_index;});
-        return (conn_iter != this->end());
+    std::optional<std::size_t> WellConnections::findGlobalIndex(std::size_t global_index) const {
+        auto iter = this->m_global_index_map.find(global_index);
+        if (iter == this->m_global_index_map.end())
+            return {};
+
+        return iter->second;
     }
 
 
-    const Connection& WellConnections::getFromIJK(const int i, const int j, const int k) const {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return get(ic);
+    std::optional<std::size_t> WellConnections::findIJK(const int i, const int j, const int k) const {
+        auto iter = this->m_ijk_map.find(ijk_key(i, j, k));
+        if (iter != this->m_ijk_map.end() && this->m_connections[iter->second].sameCoordinate(i, j, k))
+            return iter->second;
+
+        // Only coordinates outside the range of the packed key can collide.
+        if (iter != this->m_ijk_map.end()) {
+            for (size_t ic = 0; ic < size(); ++ic) {
+                if (this->m_connections[ic].sameCoordinate(i, j, k))
+                    return ic;
             }
         }
-        throw std::runtime_error(" the connection is not found! \n ");
+
+        return {};
     }
 
 
-    const Connection& WellConnections::getFromGlobalIndex(std::size_t global_index) const {
-        auto conn_iter = std::find_if(this->begin(), this->end(),
-                                      [global_index] (const Connection& conn) {return conn.global_index() == global_index;});
+    void WellConnections::indexConnection(const std::size_t pos) {
+        const auto& conn = this->m_connections[pos];
+
+        // Keep the first connection in each cell, as a linear search would.
+        this->m_global_index_map.emplace(conn.global_index(), pos);
+        this->m_ijk_map.emplace(ijk_key(conn.getI(), conn.getJ(), conn.getK()), pos);
+    }
+
+
+    void WellConnections::rebuildIndex() {
+        this->m_global_index_map.clear();
+        this->m_ijk_map.clear();
+        this->m_global_index_map.reserve(this->m_connections.size());
+        this->m_ijk_map.reserve(this->m_connections.size());
 
-        if (conn_iter == this->end())
+        for (std::size_t pos = 0; pos < this->m_connections.size(); ++pos)
+            this->indexConnection(pos);
+    }
+
+
+    bool WellConnections::hasGlobalIndex(std::size_t global_index) const {
+        return this->findGlobalIndex(global_index).has_value();
+    }
+
+
+    std::vector<std::size_t> WellConnections::findGlobalIndices(const std::vector<std::size_t>& global_indices) const {
+        std::vector<std::size_t> positions;
+        positions.reserve(global_indices.size());
+
+        for (const auto& global_index : global_indices)
+            positions.push_back(this->findGlobalIndex(global_index).value_or(this->size()));
+
+        return positions;
+    }
+
+
+    const Connection& WellConnections::getFromIJK(const int i, const int j, const int k) const {
+        const auto pos = this->findIJK(i, j, k);
+        if (!pos.has_value())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[*pos];
+    }
+
+
+    const Connection& WellConnections::getFromGlobalIndex(std::size_t global_index) const {
+        const auto pos = this->findGlobalIndex(global_index);
+        if (!pos.has_value())
             throw std::logic_error(fmt::format("No connection with global index {}", global_index));
-        return *conn_iter;
+
+        return this->m_connections[*pos];
     }
 
 
     Connection& WellConnections::getFromIJK(const int i, const int j, const int k) {
-      for (size_t ic = 0; ic < size(); ++ic) {
-        if (get(ic).sameCoordinate(i, j, k)) {
-          return this->m_connections[ic];
-        }
-      }
-      throw std::runtime_error(" the connection is not found! \n ");
+        const auto pos = this->findIJK(i, j, k);
+        if (!pos.has_value())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[*pos];
     }
 
 
     void WellConnections::add( Connection connection ) {
         m_connections.emplace_back( connection );
+        this->indexConnection(this->m_connections.size() - 1);
     }
 
     bool WellConnections::allConnectionsShut( ) const {
@@ -544,6 +605,8 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
             this->orderTRACK();
         else if (this->m_ordering == Connection::Order::DEPTH)
             this->orderDEPTH();
+
+        this->rebuildIndex();
     }
 
 
@@ -631,6 +694,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
 
         auto new_end = std::remove_if(m_connections.begin(), m_connections.end(), isInactive);
         m_connections.erase(new_end, m_connections.end());
+        this->rebuildIndex();
     }
 
 
@@ -650,16 +714,10 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
     getCompletionNumberFromGlobalConnectionIndex(const WellConnections& connections,
                                                  const std::size_t      global_index)
     {
-        auto connPos = std::find_if(connections.begin(), connections.end(),
-            [global_index](const Connection& conn)
-        {
-            return conn.global_index() == global_index;
-        });
-
-        if (connPos == connections.end())
+        if (! connections.hasGlobalIndex(global_index))
             // No connection exists with the requisite 'global_index'
             return {};
 
-        return { connPos->complnum() };
+        return { connections.getFromGlobalIndex(global_index).complnum() };
     }
 }
@@ -66,11 +66,10 @@ std::vector<std::string> WellMatcher::wells(const std::string& pattern) const {
     // Normal pattern matching
     auto star_pos = pattern.find('*');
     if (star_pos != std::string::npos) {
+        const auto& well_names = this->m_well_order.names();
         std::vector<std::string> names;
-        for (const auto& wname : this->m_well_order) {
-            if (shmatch(pattern, wname))
-                names.push_back(wname);
-        }
+        for (const auto& index : match_all(pattern, well_names))
+            names.push_back(well_names[index]);
         return names;
     }
 
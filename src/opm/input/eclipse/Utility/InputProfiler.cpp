@@ -0,0 +1,184 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Utility/InputProfiler.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/json/JsonObject.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+namespace {
+
+struct KeywordTiming {
+    std::size_t calls = 0;
+    double seconds = 0;
+};
+
+struct ProfileData {
+    std::atomic<bool> enabled{false};
+    std::mutex mutex;
+    std::map<std::string, std::unordered_map<std::string, KeywordTiming>> keywords;
+    std::optional<ScheduleMemoryReport> schedule_memory;
+};
+
+ProfileData& profile_data() {
+    static ProfileData data;
+    return data;
+}
+
+void add_keywords(Json::JsonObject& keywords, const std::string& category,
+                  const std::unordered_map<std::string, KeywordTiming>& timings) {
+    std::vector<std::pair<std::string, KeywordTiming>> sorted(timings.begin(), timings.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.second.seconds != rhs.second.seconds)
+            return lhs.second.seconds > rhs.second.seconds;
+        return lhs.first < rhs.first;
+    });
+
+    auto list = keywords.add_array(category);
+    for (const auto& [keyword, timing] : sorted) {
+        auto item = list.add_object();
+        item.add_item("keyword", keyword);
+        item.add_item("calls", static_cast<double>(timing.calls));
+        item.add_item("seconds", timing.seconds);
+    }
+}
+
+void add_memory(Json::JsonObject& root, const ScheduleMemoryReport& report) {
+    auto memory = root.add_object("schedule_memory");
+    memory.add_item("total_bytes", static_cast<double>(report.total_bytes()));
+
+    auto step_bytes = memory.add_array("step_bytes");
+    for (const auto& bytes : report.step_bytes)
+        step_bytes.add(static_cast<double>(bytes));
+
+    auto members = memory.add_object("members");
+    for (const auto& [member, entry] : report.members) {
+        auto item = members.add_object(member);
+        item.add_item("count", static_cast<double>(entry.count));
+        item.add_item("bytes", static_cast<double>(entry.bytes));
+    }
+}
+
+}
+
+
+InputProfiler::Timer::Timer(const char* category_arg, const std::string& keyword_arg) {
+    if (!InputProfiler::enabled())
+        return;
+
+    this->category = category_arg;
+    this->keyword = keyword_arg;
+    this->start = std::chrono::steady_clock::now();
+}
+
+InputProfiler::Timer::~Timer() {
+    if (this->category == nullptr)
+        return;
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - this->start;
+    InputProfiler::record(this->category, this->keyword, elapsed.count());
+}
+
+
+void InputProfiler::enable() {
+    profile_data().enabled = true;
+}
+
+void InputProfiler::disable() {
+    profile_data().enabled = false;
+}
+
+bool InputProfiler::enabled() {
+    return profile_data().enabled;
+}
+
+void InputProfiler::reset() {
+    auto& data = profile_data();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.keywords.clear();
+    data.schedule_memory.reset();
+}
+
+InputProfiler::Timer InputProfiler::time(const char* category, const std::string& keyword) {
+    return Timer(category, keyword);
+}
+
+void InputProfiler::record(const std::string& category, const std::string& keyword, double seconds) {
+    auto& data = profile_data();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    auto& timing = data.keywords[category][keyword];
+    timing.calls += 1;
+    timing.seconds += seconds;
+}
+
+void InputProfiler::recordSchedule(const Schedule& schedule) {
+    if (!InputProfiler::enabled())
+        return;
+
+    auto report = schedule.memoryReport();
+    auto& data = profile_data();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.schedule_memory = std::move(report);
+}
+
+
+std::string InputProfiler::json() {
+    auto& data = profile_data();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    Json::JsonObject root;
+    auto keywords = root.add_object("keywords");
+    for (const auto& [category, timings] : data.keywords)
+        add_keywords(keywords, category, timings);
+
+    if (data.schedule_memory.has_value())
+        add_memory(root, data.schedule_memory.value());
+
+    return root.dump() + "\n";
+}
+
+void InputProfiler::writeJson(const std::string& filename) {
+    std::ofstream stream(filename);
+    if (!stream)
+        throw std::runtime_error(fmt::format("Could not open input profile file {} for writing", filename));
+
+    stream << InputProfiler::json();
+}
+
+void InputProfiler::logJson() {
+    OpmLog::info(fmt::format("Input profile:\n{}", InputProfiler::json()));
+}
+
+}
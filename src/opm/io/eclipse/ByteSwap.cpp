@@ -0,0 +1,270 @@
+/*
+   Copyright 2022 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ByteSwap.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OPM_BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define OPM_BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using SwapFunction = void (*)(const char*, char*, std::size_t);
+
+void swap32_scalar(const char* src, char* dst, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        std::uint32_t value;
+        std::memcpy(&value, src + 4*i, 4);
+        value = __builtin_bswap32(value);
+        std::memcpy(dst + 4*i, &value, 4);
+    }
+}
+
+void swap64_scalar(const char* src, char* dst, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        std::uint64_t value;
+        std::memcpy(&value, src + 8*i, 8);
+        value = __builtin_bswap64(value);
+        std::memcpy(dst + 8*i, &value, 8);
+    }
+}
+
+#ifdef OPM_BYTESWAP_X86
+
+__attribute__((target("ssse3")))
+void swap32_ssse3(const char* src, char* dst, std::size_t count)
+{
+    const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4*i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4*i), _mm_shuffle_epi8(v, mask));
+    }
+
+    swap32_scalar(src + 4*i, dst + 4*i, count - i);
+}
+
+__attribute__((target("ssse3")))
+void swap64_ssse3(const char* src, char* dst, std::size_t count)
+{
+    const __m128i mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8*i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8*i), _mm_shuffle_epi8(v, mask));
+    }
+
+    swap64_scalar(src + 8*i, dst + 8*i, count - i);
+}
+
+__attribute__((target("avx2")))
+void swap32_avx2(const char* src, char* dst, std::size_t count)
+{
+    const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4*i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4*i), _mm256_shuffle_epi8(v, mask));
+    }
+
+    swap32_scalar(src + 4*i, dst + 4*i, count - i);
+}
+
+__attribute__((target("avx2")))
+void swap64_avx2(const char* src, char* dst, std::size_t count)
+{
+    const __m256i mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                          7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8*i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 8*i), _mm256_shuffle_epi8(v, mask));
+    }
+
+    swap64_scalar(src + 8*i, dst + 8*i, count - i);
+}
+
+#endif // OPM_BYTESWAP_X86
+
+#ifdef OPM_BYTESWAP_NEON
+
+void swap32_neon(const char* src, char* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + 4*i));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + 4*i), vrev32q_u8(v));
+    }
+
+    swap32_scalar(src + 4*i, dst + 4*i, count - i);
+}
+
+void swap64_neon(const char* src, char* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + 8*i));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + 8*i), vrev64q_u8(v));
+    }
+
+    swap64_scalar(src + 8*i, dst + 8*i, count - i);
+}
+
+#endif // OPM_BYTESWAP_NEON
+
+bool kernelAvailable(Opm::EclIO::ByteSwapKernel kernel)
+{
+    using Kernel = Opm::EclIO::ByteSwapKernel;
+
+    switch (kernel) {
+    case Kernel::Scalar:
+        return true;
+#ifdef OPM_BYTESWAP_X86
+    case Kernel::SSSE3:
+        return __builtin_cpu_supports("ssse3");
+    case Kernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+#ifdef OPM_BYTESWAP_NEON
+    case Kernel::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+std::pair<SwapFunction, SwapFunction> kernelFunctions(Opm::EclIO::ByteSwapKernel kernel)
+{
+    using Kernel = Opm::EclIO::ByteSwapKernel;
+
+    if (!kernelAvailable(kernel))
+        throw std::invalid_argument("Byte swap kernel " + Opm::EclIO::byteSwapKernelName(kernel) + " is not available");
+
+    switch (kernel) {
+#ifdef OPM_BYTESWAP_X86
+    case Kernel::SSSE3:
+        return { swap32_ssse3, swap64_ssse3 };
+    case Kernel::AVX2:
+        return { swap32_avx2, swap64_avx2 };
+#endif
+#ifdef OPM_BYTESWAP_NEON
+    case Kernel::NEON:
+        return { swap32_neon, swap64_neon };
+#endif
+    default:
+        return { swap32_scalar, swap64_scalar };
+    }
+}
+
+struct ActiveKernel {
+    Opm::EclIO::ByteSwapKernel kernel;
+    SwapFunction swap32;
+    SwapFunction swap64;
+
+    ActiveKernel()
+    {
+        // The kernels are listed in increasing order of preference.
+        this->kernel = Opm::EclIO::availableByteSwapKernels().back();
+        std::tie(this->swap32, this->swap64) = kernelFunctions(this->kernel);
+    }
+};
+
+const ActiveKernel& activeKernel()
+{
+    static const ActiveKernel kernel;
+    return kernel;
+}
+
+}
+
+
+namespace Opm { namespace EclIO {
+
+ByteSwapKernel activeByteSwapKernel()
+{
+    return activeKernel().kernel;
+}
+
+std::vector<ByteSwapKernel> availableByteSwapKernels()
+{
+    std::vector<ByteSwapKernel> kernels;
+
+    for (auto kernel : { ByteSwapKernel::Scalar, ByteSwapKernel::SSSE3, ByteSwapKernel::NEON, ByteSwapKernel::AVX2 }) {
+        if (kernelAvailable(kernel))
+            kernels.push_back(kernel);
+    }
+
+    return kernels;
+}
+
+std::string byteSwapKernelName(ByteSwapKernel kernel)
+{
+    switch (kernel) {
+    case ByteSwapKernel::Scalar:
+        return "scalar";
+    case ByteSwapKernel::SSSE3:
+        return "ssse3";
+    case ByteSwapKernel::AVX2:
+        return "avx2";
+    case ByteSwapKernel::NEON:
+        return "neon";
+    }
+
+    return "unknown";
+}
+
+void byteSwap32(const void* src, void* dst, std::size_t count)
+{
+    activeKernel().swap32(static_cast<const char*>(src), static_cast<char*>(dst), count);
+}
+
+void byteSwap64(const void* src, void* dst, std::size_t count)
+{
+    activeKernel().swap64(static_cast<const char*>(src), static_cast<char*>(dst), count);
+}
+
+void byteSwap32(const void* src, void* dst, std::size_t count, ByteSwapKernel kernel)
+{
+    kernelFunctions(kernel).first(static_cast<const char*>(src), static_cast<char*>(dst), count);
+}
+
+void byteSwap64(const void* src, void* dst, std::size_t count, ByteSwapKernel kernel)
+{
+    kernelFunctions(kernel).second(static_cast<const char*>(src), static_cast<char*>(dst), count);
+}
+
+}} // namespace Opm::EclIO
@@ -39,7 +39,11 @@ namespace Opm { namespace EclIO {
 using NNCentry = std::tuple<int, int, int, int, int,int, float>;
 
 EGrid::EGrid(const std::string &filename, std::string grid_name) :
-    EclFile(filename), inputFileName { filename }, m_grid_name {grid_name}
+    EGrid(filename, EclFile::MemoryMapped{false}, std::move(grid_name))
+{}
+
+EGrid::EGrid(const std::string &filename, EclFile::MemoryMapped mmap, std::string grid_name) :
+    EclFile(filename, mmap), inputFileName { filename }, m_grid_name {grid_name}
 {
     initFileName = inputFileName.parent_path() / inputFileName.stem();
 
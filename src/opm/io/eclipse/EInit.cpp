@@ -24,7 +24,10 @@
 namespace Opm { namespace EclIO {
 
 
-EInit::EInit(const std::string &filename) : EclFile(filename)
+EInit::EInit(const std::string &filename) : EInit(filename, EclFile::MemoryMapped{false})
+{}
+
+EInit::EInit(const std::string &filename, EclFile::MemoryMapped mmap) : EclFile(filename, mmap)
 {
     std::string lgrname;
     std::string nncname;
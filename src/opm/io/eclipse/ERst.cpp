@@ -54,7 +54,12 @@ namespace {
 namespace Opm { namespace EclIO {
 
 ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+    : ERst(filename, EclFile::MemoryMapped{false})
+{}
+
+
+ERst::ERst(const std::string& filename, EclFile::MemoryMapped mmap)
+    : EclFile(filename, mmap)
 {
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
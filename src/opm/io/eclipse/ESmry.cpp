@@ -21,6 +21,7 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
@@ -676,11 +677,8 @@ std::string ESmry::read_string_from_disk(std::fstream& fileH, uint64_t size) con
 
 void ESmry::loadData(const std::vector<std::string>& vectList) const
 {
-    auto start = std::chrono::system_clock::now();
-    size_t nvect = vectList.size();
-
     std::vector<int> keywIndVect;
-    keywIndVect.reserve(nvect);
+    keywIndVect.reserve(vectList.size());
 
     for (auto key : vectList) {
         if (!hasKey(key))
@@ -690,13 +688,30 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
         keywIndVect.push_back(it->second);
     }
 
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
+    auto values = read_vectors(keywIndVect, 0, timeStepList.size());
+
+    for (std::size_t n = 0; n < keywIndVect.size(); n++) {
+        vectorData[keywIndVect[n]] = std::move(values[n]);
+        vectorLoaded[keywIndVect[n]] = true;
+    }
+}
+
+std::vector<std::vector<float>>
+ESmry::read_vectors(const std::vector<int>& keywIndVect, std::size_t first, std::size_t last) const
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<std::vector<float>> values(keywIndVect.size());
+    if (first >= last)
+        return values;
+
+    for (auto& vect : values)
+        vect.reserve(last - first);
 
     std::fstream fileH;
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
+    auto specInd = std::get<0>(timeStepList[first]);
+    auto dataFileIndex = std::get<1>(timeStepList[first]);
     std::uint64_t blockSize_f;
 
     {
@@ -711,7 +726,9 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
     else
         fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
 
-    for (const auto& ministep : timeStepList) {
+    for (auto step = first; step < last; step++) {
+        const auto& ministep = timeStepList[step];
+
         if (dataFileIndex != std::get<1>(ministep)) {
             fileH.close();
             specInd = std::get<0>(ministep);
@@ -725,12 +742,12 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
         const auto stepFilePos = std::get<2>(ministep);;
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
+        for (std::size_t n = 0; n < keywIndVect.size(); n++) {
+            auto it = arrayPos[specInd].find(keywIndVect[n]);
             if (it == arrayPos[specInd].end()) {
                 // undefined vector in current summary file. Typically when loading
                 // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
+                values[n].push_back(std::nanf(""));
             }
             else {
                 int paramPos = it->second;
@@ -751,7 +768,7 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                     const std::size_t size = columnWidthReal;
                     std::vector<char> buffer(size);
                     fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
+                    values[n].push_back(std::strtof(buffer.data(), nullptr));
                 }
                 else {
                     const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
@@ -763,7 +780,7 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                     float value;
                     fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
+                    values[n].push_back(Opm::EclIO::flipEndianFloat(value));
                 }
             }
         }
@@ -771,11 +788,10 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
     fileH.close();
 
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
-
     std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
     m_io_loading += elapsed_seconds.count();
+
+    return values;
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -815,6 +831,8 @@ void ESmry::loadData() const
 
     fileH.open(dataFileList[dataFileIndex], openMode);
 
+    std::vector<float> recordBuffer(MaxBlockSizeReal / sizeOfReal);
+
     for (const auto& ministep : timeStepList) {
         if (dataFileIndex != std::get<1>(ministep)) {
             fileH.close();
@@ -871,12 +889,12 @@ void ESmry::loadData() const
                 if ((num > maxNumberOfElements) || (num < 0))
                     OPM_THROW(std::runtime_error, "??Error reading binary data, inconsistent header data or incorrect number of elements");
 
-                for (int i = 0; i < num; ++i, ++p) {
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+                fileH.read(reinterpret_cast<char*>(recordBuffer.data()), num * sizeOfReal);
+                Opm::EclIO::byteSwap(recordBuffer.data(), num);
 
+                for (int i = 0; i < num; ++i, ++p) {
                     if ((keywpos[p] > -1) && !vectorLoaded[keywpos[p]])
-                        vectorData[keywpos[p]].push_back(Opm::EclIO::flipEndianFloat(value));
+                        vectorData[keywpos[p]].push_back(recordBuffer[i]);
                 }
 
                 rest -= num;
@@ -1311,6 +1329,78 @@ const std::vector<float>& ESmry::get(const std::string& name) const
     return vectorData[ind];
 }
 
+std::vector<float> ESmry::get(const std::string& name, double t0, double t1) const
+{
+    auto it = keyword_index.find(name);
+    if (it == keyword_index.end())
+        OPM_THROW(std::invalid_argument, "keyword " + name + " not found ");
+
+    const auto [first, last] = this->time_range(t0, t1);
+
+    if (vectorLoaded[it->second]) {
+        const auto& vect = vectorData[it->second];
+        return { vect.begin() + first, vect.begin() + last };
+    }
+
+    return std::move(this->read_vectors({ it->second }, first, last).front());
+}
+
+SummaryHistory ESmry::history(const std::vector<std::string>& vectList, double t0, double t1) const
+{
+    const auto [first, last] = this->time_range(t0, t1);
+
+    std::vector<std::vector<float>> columns(vectList.size());
+    std::vector<int> unloaded;
+    std::vector<std::size_t> unloadedColumn;
+
+    for (std::size_t n = 0; n < vectList.size(); n++) {
+        auto it = keyword_index.find(vectList[n]);
+        if (it == keyword_index.end())
+            OPM_THROW(std::invalid_argument, "keyword " + vectList[n] + " not found ");
+
+        if (vectorLoaded[it->second]) {
+            const auto& vect = vectorData[it->second];
+            columns[n].assign(vect.begin() + first, vect.begin() + last);
+        }
+        else {
+            unloaded.push_back(it->second);
+            unloadedColumn.push_back(n);
+        }
+    }
+
+    auto values = this->read_vectors(unloaded, first, last);
+    for (std::size_t n = 0; n < unloaded.size(); n++)
+        columns[unloadedColumn[n]] = std::move(values[n]);
+
+    const auto& time = this->get("TIME");
+
+    SummaryHistory result(vectList, std::max(last - first, std::size_t{1}));
+    std::vector<float> row(vectList.size());
+    for (auto step = first; step < last; step++) {
+        for (std::size_t n = 0; n < columns.size(); n++)
+            row[n] = columns[n][step - first];
+
+        result.append(time[step], row);
+    }
+
+    return result;
+}
+
+std::pair<std::size_t, std::size_t> ESmry::time_range(double t0, double t1) const
+{
+    // The TIME vector is loaded once, the range is then found by binary
+    // search without touching the other vectors.
+    const auto& time = this->get("TIME");
+
+    const auto first = std::lower_bound(time.begin(), time.end(), t0,
+                                        [](float t, double value) { return t < value; });
+    const auto last = std::upper_bound(first, time.end(), t1,
+                                       [](double value, float t) { return value < t; });
+
+    return { static_cast<std::size_t>(std::distance(time.begin(), first)),
+             static_cast<std::size_t>(std::distance(time.begin(), last)) };
+}
+
 std::vector<float> ESmry::get_at_rstep(const std::string& name) const
 {
     return this->rstep_vector( this->get(name) );
@@ -1344,9 +1434,8 @@ std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
 
-    for (auto key : keyword)
-        if (shmatch(pattern, key))
-            list.push_back(key);
+    for (const auto& index : match_all(pattern, keyword))
+        list.push_back(keyword[index]);
 
     return list;
 }
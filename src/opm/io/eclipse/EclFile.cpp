@@ -19,6 +19,7 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/MappedFile.hpp>
 
 #include <fmt/format.h>
 #include <algorithm>
@@ -36,6 +37,61 @@
 #include <iostream>
 
 
+namespace {
+
+std::vector<std::string> decodeMappedStrings(const char* record, int64_t size, int elementSize)
+{
+    using namespace Opm::EclIO;
+
+    const int64_t recordElements = MaxBlockSizeChar / sizeOfChar;
+
+    std::vector<std::string> values;
+    values.reserve(size);
+
+    int64_t rest = size;
+    while (rest > 0) {
+        const auto num = std::min(rest, recordElements);
+        int head;
+        std::memcpy(&head, record, sizeof(head));
+        head = flipEndianInt(head);
+
+        if (head != num * elementSize)
+            OPM_THROW(std::runtime_error, "Error reading memory mapped binary data, inconsistent header data or incorrect number of elements");
+
+        int tail;
+        std::memcpy(&tail, record + sizeof(int) + num * elementSize, sizeof(tail));
+        tail = flipEndianInt(tail);
+
+        if (head != tail)
+            OPM_THROW(std::runtime_error, "Error reading memory mapped binary data, tail not matching header.");
+
+        const char* src = record + sizeof(int);
+        for (int64_t i = 0; i < num; i++)
+            values.push_back(trimr(std::string(src + i * elementSize, elementSize)));
+
+        rest -= num;
+        record += num * elementSize + 2 * sizeof(int);
+    }
+
+    return values;
+}
+
+template <typename T>
+Opm::EclIO::eclArrType viewArrayType()
+{
+    if constexpr (std::is_same_v<T, int>)
+        return Opm::EclIO::INTE;
+    else if constexpr (std::is_same_v<T, float>)
+        return Opm::EclIO::REAL;
+    else if constexpr (std::is_same_v<T, double>)
+        return Opm::EclIO::DOUB;
+    else
+        return Opm::EclIO::LOGI;
+}
+
+}
+
+
 namespace Opm { namespace EclIO {
 
 void EclFile::load(bool preload) {
@@ -116,6 +172,51 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
+    inputFilename(filename)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    formatted = isFormatted(filename);
+
+    if (mmap.value && !formatted)
+        this->mapFile();
+
+    this->load(preload);
+}
+
+
+void EclFile::mapFile()
+{
+    if (formatted)
+        OPM_THROW(std::runtime_error, "Memory mapping is only supported for unformatted files: " + inputFilename);
+
+    if (!this->mapped_file)
+        this->mapped_file = std::make_shared<const MappedFile>(inputFilename);
+}
+
+
+/*
+  Views of a file opened in stream mode are served from a separate mapping,
+  so that asking for a view does not switch the loading of arrays over to
+  the memory mapped code path.
+*/
+const std::shared_ptr<const MappedFile>& EclFile::viewMapping()
+{
+    if (this->mapped_file)
+        return this->mapped_file;
+
+    if (formatted)
+        OPM_THROW(std::runtime_error, "Memory mapping is only supported for unformatted files: " + inputFilename);
+
+    if (!this->view_mapping)
+        this->view_mapping = std::make_shared<const MappedFile>(inputFilename);
+
+    return this->view_mapping;
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
@@ -149,6 +250,48 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
     arrayLoaded[arrIndex] = true;
 }
 
+void EclFile::loadMappedArray(std::size_t arrIndex)
+{
+    const auto size = array_size[arrIndex];
+
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = this->getView<int>(arrIndex).decode();
+        break;
+    case REAL:
+        real_array[arrIndex] = this->getView<float>(arrIndex).decode();
+        break;
+    case DOUB:
+        doub_array[arrIndex] = this->getView<double>(arrIndex).decode();
+        break;
+    case LOGI: {
+        const auto raw = this->getView<unsigned int>(arrIndex);
+        std::vector<bool> values(size);
+        for (std::size_t i = 0; i < raw.size(); i++) {
+            const auto value = raw[i];
+            if ((value == true_value_ecl) || (value == true_value_ix))
+                values[i] = true;
+            else if (value != false_value)
+                OPM_THROW(std::runtime_error, "Error reading logi value");
+        }
+        logi_array[arrIndex] = std::move(values);
+        break;
+    }
+    case CHAR:
+    case C0NN:
+        char_array[arrIndex] = decodeMappedStrings(this->mapped_file->data() + ifStreamPos[arrIndex],
+                                                   size, array_element_size[arrIndex]);
+        break;
+    case MESS:
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        break;
+    }
+
+    arrayLoaded[arrIndex] = true;
+}
+
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, int64_t fromPos)
 {
 
@@ -192,6 +335,12 @@ void EclFile::loadData()
 
         this->loadData(arrIndices);
 
+    } else if (this->mapped_file) {
+
+        for (size_t i = 0; i < array_name.size(); i++) {
+            loadMappedArray(i);
+        }
+
     } else {
 
         std::fstream fileH;
@@ -234,6 +383,14 @@ void EclFile::loadData(const std::string& name)
             }
         }
 
+    } else if (this->mapped_file) {
+
+        for (size_t i = 0; i < array_name.size(); i++) {
+            if (array_name[i] == name) {
+                loadMappedArray(i);
+            }
+        }
+
     } else {
 
         std::fstream fileH;
@@ -275,6 +432,12 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
             loadFormattedArray(fileStr, ind, 0);
         }
 
+    } else if (this->mapped_file) {
+
+        for (int ind : arrIndex) {
+            loadMappedArray(ind);
+        }
+
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -310,6 +473,8 @@ void EclFile::loadData(int arrIndex)
             loadFormattedArray(fileStr, arrIndex, 0);
 
 
+    } else if (this->mapped_file) {
+        loadMappedArray(arrIndex);
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -638,6 +803,52 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+template <typename T>
+EclArrayView<T> EclFile::getView(int arrIndex)
+{
+    if ((arrIndex < 0) || (static_cast<std::size_t>(arrIndex) >= array_name.size())) {
+        std::string message = "Array index " + std::to_string(arrIndex) + " out of range";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    const auto type = viewArrayType<T>();
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " can not be viewed as requested type";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    const auto& mapping = this->viewMapping();
+
+    if (ifStreamPos[arrIndex] + sizeOnDiskBinary(array_size[arrIndex], type, array_element_size[arrIndex]) > mapping->size())
+        OPM_THROW(std::runtime_error, "Array " + array_name[arrIndex] + " extends beyond end of file " + inputFilename);
+
+    return { mapping, mapping->data() + ifStreamPos[arrIndex], array_size[arrIndex] };
+}
+
+template <typename T>
+EclArrayView<T> EclFile::getView(const std::string& name)
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->getView<T>(search->second);
+}
+
+template EclArrayView<int> EclFile::getView<int>(int arrIndex);
+template EclArrayView<unsigned int> EclFile::getView<unsigned int>(int arrIndex);
+template EclArrayView<float> EclFile::getView<float>(int arrIndex);
+template EclArrayView<double> EclFile::getView<double>(int arrIndex);
+
+template EclArrayView<int> EclFile::getView<int>(const std::string& name);
+template EclArrayView<unsigned int> EclFile::getView<unsigned int>(const std::string& name);
+template EclArrayView<float> EclFile::getView<float>(const std::string& name);
+template EclArrayView<double> EclFile::getView<double>(const std::string& name);
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
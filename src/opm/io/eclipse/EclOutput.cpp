@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -31,6 +32,7 @@
 #include <ios>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <typeinfo>
 
 namespace Opm { namespace EclIO {
@@ -251,6 +253,16 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
     int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
+    // Buffers for one record of data converted to file representation,
+    // reused for all records in the array.
+    std::vector<T> flipped_data;
+    std::vector<int> logi_data;
+
+    if constexpr (std::is_same_v<T, bool>)
+        logi_data.resize(maxNumberOfElements);
+    else
+        flipped_data.resize(std::min<int64_t>(size, maxNumberOfElements));
+
     rest = size * static_cast<int64_t>(sizeOfElement);
 
     offset = 0;
@@ -268,48 +280,20 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
+        if constexpr (std::is_same_v<T, bool>) {
 
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
+            std::fill(logi_data.begin(), logi_data.begin() + num, false_value);
 
             for (int m = 0; m < num; m++)
                 if (data[m + offset])
                     logi_data[m] = logi_true_val;
-                else
-                    logi_data[m] = false_value;
 
-            ofileH.write((char*)(logi_data.data()), logi_data.size() * sizeof(int)) ;
+            ofileH.write((char*)(logi_data.data()), num * sizeof(int)) ;
+
+        } else if constexpr (std::is_arithmetic_v<T> && ((sizeof(T) == 4) || (sizeof(T) == 8))) {
+
+            byteSwap(data.data() + offset, flipped_data.data(), num);
+            ofileH.write((char*)(flipped_data.data()), num * sizeof(T)) ;
 
         } else {
 
@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ByteSwap.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -30,6 +31,59 @@
 //temporary
 #include <iostream>
 
+namespace {
+
+// Numeric arrays are read record by record directly into the output
+// vector, and each record is converted to native byte order in bulk.
+template <typename T>
+std::vector<T> readBinaryNumericArray(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type)
+{
+    auto sizeData = Opm::EclIO::block_size_data_binary(type);
+
+    const int sizeOfElement = std::get<0>(sizeData);
+    const int maxBlockSize = std::get<1>(sizeData);
+    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    std::vector<T> arr(size);
+
+    int64_t rest = size;
+    int64_t offset = 0;
+
+    while (rest > 0) {
+        int dhead;
+        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dhead = Opm::EclIO::flipEndianInt(dhead);
+        const int num = dhead / sizeOfElement;
+
+        if ((num > maxNumberOfElements) || (num < 0) || (num > rest)) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
+        fileH.read(reinterpret_cast<char*>(arr.data() + offset), num * sizeof(T));
+        Opm::EclIO::byteSwap(arr.data() + offset, num);
+
+        rest -= num;
+        offset += num;
+
+        if ( num < maxNumberOfElements && rest != 0) {
+            std::string message = "Error reading binary data, incorrect number of elements";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        int dtail;
+        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        dtail = Opm::EclIO::flipEndianInt(dtail);
+
+        if (dhead != dtail) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+        }
+    }
+
+    return arr;
+}
+
+}
+
 int Opm::EclIO::flipEndianInt(int num)
 {
     unsigned int tmp = __builtin_bswap32(num);
@@ -472,24 +526,29 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const int64_t si
 }
 
 
+template std::vector<int> Opm::EclIO::readBinaryArray<int,int>(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
+                                                                 std::function<int(int)>& flip, int elementSize);
+template std::vector<float> Opm::EclIO::readBinaryArray<float,float>(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
+                                                                     std::function<float(float)>& flip, int elementSize);
+template std::vector<double> Opm::EclIO::readBinaryArray<double,double>(std::fstream& fileH, const int64_t size, Opm::EclIO::eclArrType type,
+                                                                        std::function<double(double)>& flip, int elementSize);
+
+
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const int64_t size)
@@ -115,12 +115,10 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     LodsmryHeadType lodsmry_head;
 
-    auto lod_offset = open_esmry(m_inputFileName, lodsmry_head);
+    m_lod_chunks.push_back(open_esmry(m_inputFileName, lodsmry_head));
 
     m_startdat = std::get<0>(lodsmry_head);
 
-    m_lod_offset.push_back(lod_offset);
-
     std::map<std::string, int> key_index;
 
     auto keyword = std::get<2>(lodsmry_head);
@@ -143,10 +141,6 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     m_nTstep_v.push_back(m_tstep_v.back().size());
 
-    auto lod_arr_size = sizeOnDiskBinary(m_nTstep_v.back(), Opm::EclIO::REAL, sizeOfReal);
-
-    m_lod_arr_size.push_back(lod_arr_size);
-
     m_tstep_range.push_back(std::make_tuple(0, m_tstep_v.back().size() - 1));
 
     if ((loadBaseRunData) && (!std::get<0>(rst_entry).empty())) {
@@ -167,18 +161,13 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_lodsmry_files.push_back(rstLodSmryFile);
 
-            lod_offset = open_esmry(rstLodSmryFile, lodsmry_head);
-
-            m_lod_offset.push_back(lod_offset);
+            m_lod_chunks.push_back(open_esmry(rstLodSmryFile, lodsmry_head));
 
             m_rstep_v.push_back(std::get<4>(lodsmry_head));
             m_tstep_v.push_back(std::get<5>(lodsmry_head));
 
             m_nTstep_v.push_back(m_tstep_v.back().size());
 
-            lod_arr_size = sizeOnDiskBinary(m_nTstep_v.back(), Opm::EclIO::REAL, sizeOfReal);
-            m_lod_arr_size.push_back(lod_arr_size);
-
             int cidx = 0;
 
             auto it = std::find_if(m_rstep_v[sim_ind].begin(), m_rstep_v[sim_ind].end(),
@@ -263,7 +252,7 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
-uint64_t ExtESmry::open_esmry(std::filesystem::path& inputFileName, LodsmryHeadType& lodsmry_head)
+std::vector<LodChunkEntry> ExtESmry::open_esmry(std::filesystem::path& inputFileName, LodsmryHeadType& lodsmry_head)
 {
     std::fstream fileH;
 
@@ -329,25 +318,66 @@ uint64_t ExtESmry::open_esmry(std::filesystem::path& inputFileName, LodsmryHeadT
 
     Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
 
-    if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
-        OPM_THROW(std::invalid_argument, "reading RSTEP, invalid lod file");
+    // Files written incrementally (see ExtSmryOutput) hold the number of valid
+    // time steps in NSTEP, followed by one or more chunks of RSTEP, TSTEP and
+    // summary vectors. Without NSTEP, the file holds exactly one chunk.
 
-    auto rstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+    const bool chunked = (arrName == "NSTEP   ");
+    int64_t nstep = 0;
 
-    Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+    if (chunked) {
+        if (arrType != Opm::EclIO::INTE)
+            OPM_THROW(std::invalid_argument, "reading NSTEP, invalid lod file");
 
-    if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE))
-        OPM_THROW(std::invalid_argument, "reading TSTEP, invalid lod file");
+        nstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size)[0];
+    }
 
-    auto tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+    std::vector<int> rstep;
+    std::vector<int> tstep;
+    std::vector<LodChunkEntry> chunks;
 
-    lodsmry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
+    while (!chunked || (static_cast<int64_t>(rstep.size()) < nstep)) {
+
+        if (chunked)
+            Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
+            OPM_THROW(std::invalid_argument, "reading RSTEP, invalid lod file");
+
+        auto chunk_rstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((arrName != "TSTEP   ") or (arrType != Opm::EclIO::INTE))
+            OPM_THROW(std::invalid_argument, "reading TSTEP, invalid lod file");
+
+        auto chunk_tstep = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
 
-    uint64_t lodsmry_offset = static_cast<uint64_t>(fileH.tellg());
+        if (chunk_rstep.size() != chunk_tstep.size())
+            throw std::runtime_error("invalid LODSMRY file, size of RSTEP not equal size of TSTEP");
+
+        chunks.emplace_back(static_cast<uint64_t>(fileH.tellg()), arr_size);
+
+        rstep.insert(rstep.end(), chunk_rstep.begin(), chunk_rstep.end());
+        tstep.insert(tstep.end(), chunk_tstep.begin(), chunk_tstep.end());
+
+        if (!chunked)
+            break;
+
+        uint64_t vect_size = 24 + sizeOnDiskBinary(arr_size, Opm::EclIO::REAL, Opm::EclIO::sizeOfReal);
+        fileH.seekg(static_cast<std::streamoff>(vect_size * keywords.size()), std::ios_base::cur);
+    }
+
+    if (chunked) {
+        rstep.resize(nstep);
+        tstep.resize(nstep);
+    }
+
+    lodsmry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
 
     fileH.close();
 
-    return lodsmry_offset;
+    return chunks;
 }
 
 
@@ -401,25 +431,38 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
 
                 int key_ind = m_keyword_index[ind].at(key);
 
-                uint64_t pos = m_lod_offset[ind] + m_lod_arr_size[ind]*static_cast<uint64_t>(key_ind);
-                pos = pos + static_cast<uint64_t>(key_ind * 24);  // adding size of binary headers
+                std::string checkName = "V" + std::to_string(key_ind);
+
+                auto& vect = m_vectorData[keyIndexVect[n]];
+                int64_t rest = to_ind + 1;
 
-                fileH.seekg (pos, fileH.beg);
+                for (const auto& [chunk_offset, chunk_size] : m_lod_chunks[ind]) {
 
-                int64_t size;
-                int sizeOfElement;
-                readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+                    if (rest <= 0)
+                        break;
 
-                arrName = Opm::EclIO::trimr(arrName);
+                    uint64_t arr_size = sizeOnDiskBinary(chunk_size, Opm::EclIO::REAL, sizeOfReal);
 
-                std::string checkName = "V" + std::to_string(key_ind);
+                    uint64_t pos = chunk_offset + arr_size*static_cast<uint64_t>(key_ind);
+                    pos = pos + static_cast<uint64_t>(key_ind * 24);  // adding size of binary headers
+
+                    fileH.seekg (pos, fileH.beg);
+
+                    int64_t size;
+                    int sizeOfElement;
+                    readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+
+                    arrName = Opm::EclIO::trimr(arrName);
 
-                if (arrName != checkName)
-                    OPM_THROW(std::invalid_argument, "lodsmry, wrong header expecting  " + checkName + " found " +  arrName);
+                    if (arrName != checkName)
+                        OPM_THROW(std::invalid_argument, "lodsmry, wrong header expecting  " + checkName + " found " +  arrName);
 
-                auto smry_data = readBinaryRealArray(fileH, size);
+                    auto smry_data = readBinaryRealArray(fileH, size);
 
-                m_vectorData[keyIndexVect[n]].insert(m_vectorData[keyIndexVect[n]].end(), smry_data.begin(), smry_data.begin() + to_ind + 1);
+                    auto num = std::min<int64_t>(rest, smry_data.size());
+                    vect.insert(vect.end(), smry_data.begin(), smry_data.begin() + num);
+                    rest -= num;
+                }
             }
         }
 
@@ -467,9 +510,8 @@ std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
 
-    for (const auto& key : m_keyword)
-        if (shmatch( pattern, key) )
-            list.push_back(key);
+    for (const auto& index : match_all(pattern, m_keyword))
+        list.push_back(m_keyword[index]);
 
     return list;
 }
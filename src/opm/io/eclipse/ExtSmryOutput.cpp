@@ -25,8 +25,11 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 
 namespace Opm { namespace EclIO {
@@ -38,6 +41,12 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
     m_nVect = valueKeys.size();
     m_nTimeSteps = 0;
 
+    m_nstep_pos = 0;
+    m_chunk_offset = 0;
+    m_chunk_arr_size = 0;
+    m_chunk_first = 0;
+    m_capacity = 0;
+
     IOConfig ioconf = es.getIOConfig();
 
     m_restart_rootn = "";
@@ -52,12 +61,16 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
 
     m_fmt = es.cfg().io().getFMTOUT();
 
+    if (m_fmt)
+        throw std::invalid_argument("ESMRY only supported for unformatted output");
+
     auto dims = es.gridDims();
 
     m_outputFileName = ioconf.getOutputDir() + "/" + ioconf.getBaseName() + ".ESMRY";
 
     m_smry_keys = this->make_modified_keys(valueKeys, dims);
     m_smryUnits = valueUnits;
+    m_pending_values.resize(m_nVect);
 
     Opm::time_point startdat = Opm::TimeService::from_time_t(start_time);
 
@@ -65,9 +78,16 @@ ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const st
 
     m_start_date_vect = {ts.day(), ts.month(), ts.year(),
         ts.hour(), ts.minutes(), ts.seconds(), 0 };
+}
+
 
-    for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++)
-        m_smrydata.push_back({});
+ExtSmryOutput::~ExtSmryOutput()
+{
+    try {
+        this->flush();
+    } catch (...) {
+        // Nothing sensible to do about a failing write in a destructor.
+    }
 }
 
 
@@ -77,21 +97,93 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step)
     if (ts_data.size() != static_cast<size_t>(m_nVect))
         throw std::invalid_argument("size of ts_data vector not same as number of smry vectors");
 
-    m_rstep.push_back(report_step);
+    if (!m_fileH.is_open())
+        this->write_header();
+
+    const int nPending = m_pending_rstep.size();
+    if (m_nTimeSteps + nPending == m_capacity) {
+        this->flush();
+        this->append_chunk();
+    }
+
+    m_pending_rstep.push_back(report_step);
+    for (int n = 0; n < m_nVect; n++)
+        m_pending_values[n].push_back(ts_data[n]);
+}
+
+
+void ExtSmryOutput::flush()
+{
+    const int nPending = m_pending_rstep.size();
+    if (nPending == 0)
+        return;
 
     // flow is yet not supporting rptonly in summary
     // tstep = {0,1,2 .. , m_nTimeSteps-1}
 
-    if (m_tstep.size()==0)
-        m_tstep.push_back(0);
-    else
-        m_tstep.push_back(m_tstep.back()+1);
+    std::vector<int> tstep(nPending);
+    std::iota(tstep.begin(), tstep.end(), m_nTimeSteps);
+
+    this->write_block(0, m_pending_rstep);
+    this->write_block(1, tstep);
+
+    for (int n = 0; n < m_nVect; n++)
+        this->write_block(n + 2, m_pending_values[n]);
+
+    // The new time steps are made visible to readers after all data
+    // has been written.
+
+    m_fileH.flush();
+
+    const int nstep = flipEndianInt(m_nTimeSteps + nPending);
+
+    m_fileH.seekp(m_nstep_pos, std::ios::beg);
+    m_fileH.write(reinterpret_cast<const char*>(&nstep), sizeof nstep);
+    m_fileH.flush();
+
+    if (!m_fileH)
+        throw std::runtime_error("Error writing to summary file " + m_outputFileName);
+
+    m_nTimeSteps += nPending;
+    m_pending_rstep.clear();
+    for (auto& values : m_pending_values)
+        values.clear();
+}
+
+
+template <typename T>
+void ExtSmryOutput::write_block(int arr_ind, const std::vector<T>& values)
+{
+    // The values go to consecutive time steps starting at m_nTimeSteps; they
+    // are contiguous on disk except where they cross a record boundary.
+
+    const std::size_t recordElements = MaxBlockSizeInte / sizeOfInte;
+
+    std::vector<T> buffer(values.size());
+    for (std::size_t i = 0; i < values.size(); i++) {
+        if constexpr (std::is_same_v<T, int>)
+            buffer[i] = flipEndianInt(values[i]);
+        else
+            buffer[i] = flipEndianFloat(values[i]);
+    }
 
-    for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++)
-        m_smrydata[n].push_back(ts_data[n]);
+    std::size_t i = 0;
+    while (i < buffer.size()) {
+        const int step = m_nTimeSteps + i;
+        const auto ind = static_cast<std::size_t>(step - m_chunk_first);
+        const auto num = std::min(buffer.size() - i, recordElements - ind % recordElements);
 
+        m_fileH.seekp(this->element_pos(arr_ind, step), std::ios::beg);
+        m_fileH.write(reinterpret_cast<const char*>(buffer.data() + i), num * sizeof(T));
+        i += num;
+    }
+}
+
+
+void ExtSmryOutput::write_header()
+{
     {
-        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::out);
+        Opm::EclIO::EclOutput outFile(m_outputFileName, false, std::ios::out);
 
         outFile.write<int>("START", m_start_date_vect);
 
@@ -102,17 +194,62 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step)
 
         outFile.write("KEYCHECK", m_smry_keys);
         outFile.write("UNITS", m_smryUnits);
+        outFile.write<int>("NSTEP", {0});
+    }
 
-        outFile.write<int>("RSTEP", m_rstep);
-        outFile.write<int>("TSTEP", m_tstep);
+    m_fileH.open(m_outputFileName, std::ios::in | std::ios::out | std::ios::binary);
 
-        for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
-            std::string vect_name="V" + std::to_string(n);
-            outFile.write<float>(vect_name, m_smrydata[n]);
-        }
+    if (!m_fileH)
+        throw std::runtime_error("Could not open summary file " + m_outputFileName);
+
+    // The NSTEP array ends with the single element and the record tail.
+
+    m_fileH.seekp(0, std::ios::end);
+    m_nstep_pos = static_cast<uint64_t>(m_fileH.tellp()) - sizeOfInte - sizeof(int);
+}
+
+
+void ExtSmryOutput::append_chunk()
+{
+    const int chunk_size = std::max(64, m_capacity);
+
+    m_fileH.flush();
+    m_fileH.seekp(0, std::ios::end);
+
+    m_chunk_offset = static_cast<uint64_t>(m_fileH.tellp());
+    m_chunk_arr_size = sizeOnDiskBinary(chunk_size, Opm::EclIO::INTE, sizeOfInte);
+    m_chunk_first = m_capacity;
+
+    {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, false, std::ios::app);
+
+        const std::vector<int> int_fill(chunk_size, 0);
+        const std::vector<float> float_fill(chunk_size, 0.0);
+
+        outFile.write<int>("RSTEP", int_fill);
+        outFile.write<int>("TSTEP", int_fill);
+
+        for (int n = 0; n < m_nVect; n++)
+            outFile.write<float>("V" + std::to_string(n), float_fill);
     }
 
-    m_nTimeSteps++;
+    m_capacity += chunk_size;
+}
+
+
+uint64_t ExtSmryOutput::element_pos(int arr_ind, int step) const
+{
+    // Arrays are RSTEP (0), TSTEP (1) and V0 .. Vn-1 (2 .. n+1), all with the
+    // same size on disk. Each array starts with a 24 byte header, the data is
+    // split in records of 1000 elements enclosed in 4 byte head and tail.
+
+    const int recordElements = MaxBlockSizeInte / sizeOfInte;
+    const uint64_t recordSize = MaxBlockSizeInte + 2 * sizeof(int);
+
+    const auto ind = static_cast<uint64_t>(step - m_chunk_first);
+
+    return m_chunk_offset + static_cast<uint64_t>(arr_ind) * (24 + m_chunk_arr_size) + 24
+        + (ind / recordElements) * recordSize + sizeof(int) + (ind % recordElements) * sizeOfInte;
 }
 
 
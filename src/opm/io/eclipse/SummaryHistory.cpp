@@ -0,0 +1,195 @@
+/*
+   Copyright 2022 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/SummaryHistory.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Opm { namespace EclIO {
+
+SummaryHistory::SummaryHistory(const std::vector<std::string>& keys, std::size_t chunkSizeArg)
+    : chunkSize(chunkSizeArg)
+    , keyList(keys)
+{
+    if (chunkSize == 0)
+        throw std::invalid_argument("SummaryHistory chunk size must be positive");
+
+    for (std::size_t k = 0; k < keyList.size(); k++)
+        keyIndex.emplace(keyList[k], k);
+}
+
+
+void SummaryHistory::append(double timeArg, const std::vector<float>& values)
+{
+    if (values.size() != keyList.size())
+        throw std::invalid_argument("SummaryHistory::append: expected " + std::to_string(keyList.size())
+                                    + " values, got " + std::to_string(values.size()));
+
+    if ((nStep > 0) && (timeArg < time(nStep - 1)))
+        throw std::invalid_argument("SummaryHistory::append: time must be non-decreasing");
+
+    const auto block = nStep / chunkSize;
+    const auto offset = nStep % chunkSize;
+
+    if (block == timeBlocks.size()) {
+        timeBlocks.emplace_back(chunkSize);
+        valueBlocks.emplace_back(chunkSize * keyList.size());
+    }
+
+    timeBlocks[block][offset] = timeArg;
+
+    auto& valueBlock = valueBlocks[block];
+    for (std::size_t k = 0; k < values.size(); k++)
+        valueBlock[k * chunkSize + offset] = values[k];
+
+    nStep++;
+}
+
+void SummaryHistory::clear()
+{
+    nStep = 0;
+}
+
+
+bool SummaryHistory::hasKey(const std::string& key) const
+{
+    return keyIndex.find(key) != keyIndex.end();
+}
+
+std::size_t SummaryHistory::index(const std::string& key) const
+{
+    auto it = keyIndex.find(key);
+    if (it == keyIndex.end())
+        throw std::invalid_argument("keyword " + key + " not found in summary history");
+
+    return it->second;
+}
+
+
+double SummaryHistory::time(std::size_t step) const
+{
+    if (step >= nStep)
+        throw std::out_of_range("SummaryHistory: time step " + std::to_string(step)
+                                + " outside valid range 0 .. " + std::to_string(nStep));
+
+    return timeBlocks[step / chunkSize][step % chunkSize];
+}
+
+std::vector<double> SummaryHistory::times() const
+{
+    std::vector<double> result;
+    result.reserve(nStep);
+
+    for (std::size_t step = 0; step < nStep; step++)
+        result.push_back(timeBlocks[step / chunkSize][step % chunkSize]);
+
+    return result;
+}
+
+std::vector<double> SummaryHistory::times(double t0, double t1) const
+{
+    const auto [first, last] = range(t0, t1);
+
+    std::vector<double> result;
+    result.reserve(last - first);
+
+    for (auto step = first; step < last; step++)
+        result.push_back(timeBlocks[step / chunkSize][step % chunkSize]);
+
+    return result;
+}
+
+std::pair<std::size_t, std::size_t> SummaryHistory::range(double t0, double t1) const
+{
+    auto partition = [this](auto predicate)
+    {
+        std::size_t first = 0;
+        std::size_t count = nStep;
+
+        while (count > 0) {
+            const auto half = count / 2;
+            const auto mid = first + half;
+
+            if (predicate(timeBlocks[mid / chunkSize][mid % chunkSize])) {
+                first = mid + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+
+        return first;
+    };
+
+    const auto first = partition([t0](double t) { return t < t0; });
+    const auto last = partition([t1](double t) { return t <= t1; });
+
+    return { first, std::max(first, last) };
+}
+
+
+std::vector<float> SummaryHistory::column(std::size_t key, std::size_t first, std::size_t last) const
+{
+    std::vector<float> result;
+    result.reserve(last - first);
+
+    auto step = first;
+    while (step < last) {
+        const auto block = step / chunkSize;
+        const auto offset = step % chunkSize;
+        const auto count = std::min(chunkSize - offset, last - step);
+
+        const auto begin = valueBlocks[block].begin() + key * chunkSize + offset;
+        result.insert(result.end(), begin, begin + count);
+
+        step += count;
+    }
+
+    return result;
+}
+
+std::vector<float> SummaryHistory::get(const std::string& key) const
+{
+    return column(index(key), 0, nStep);
+}
+
+std::vector<float> SummaryHistory::get(const std::string& key, double t0, double t1) const
+{
+    const auto key_index = index(key);
+    const auto [first, last] = range(t0, t1);
+
+    return column(key_index, first, last);
+}
+
+void SummaryHistory::row(std::size_t step, std::vector<float>& values) const
+{
+    if (step >= nStep)
+        throw std::out_of_range("SummaryHistory: time step " + std::to_string(step)
+                                + " outside valid range 0 .. " + std::to_string(nStep));
+
+    const auto& valueBlock = valueBlocks[step / chunkSize];
+    const auto offset = step % chunkSize;
+
+    values.resize(keyList.size());
+    for (std::size_t k = 0; k < keyList.size(); k++)
+        values[k] = valueBlock[k * chunkSize + offset];
+}
+
+}} // namespace Opm::EclIO
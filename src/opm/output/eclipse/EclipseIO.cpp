@@ -26,6 +26,11 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
@@ -54,12 +59,18 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 
@@ -98,6 +109,121 @@ void ensure_directory_exists( const std::filesystem::path& odir )
     }
 }
 
+/*
+  The AsyncWriter runs output tasks on a dedicated thread, in the order they
+  were submitted. At most max_pending tasks - including the one currently
+  being executed - are alive; push() blocks until a slot is available. The
+  first exception raised by a task is kept and rethrown from the next call
+  to push() or flush(), the remaining tasks are still executed.
+*/
+
+class AsyncWriter {
+public:
+    explicit AsyncWriter(std::size_t max_pending);
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    void push(std::function<void()> task);
+    void flush();
+
+    // Whether a task is queued or being run.
+    bool pending();
+
+private:
+    std::size_t max_pending;
+    std::deque<std::function<void()>> tasks;
+    bool busy{false};
+    bool stop{false};
+    std::exception_ptr error;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread thread;
+
+    void run();
+    void rethrow(std::unique_lock<std::mutex>& lock);
+};
+
+AsyncWriter::AsyncWriter(std::size_t max_pending_arg)
+    : max_pending(std::max(max_pending_arg, std::size_t{1}))
+    , thread(&AsyncWriter::run, this)
+{}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stop = true;
+    }
+    this->cv.notify_all();
+    this->thread.join();
+}
+
+void AsyncWriter::push(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->cv.wait(lock, [this] {
+        return this->tasks.size() + (this->busy ? 1 : 0) < this->max_pending;
+    });
+    this->rethrow(lock);
+
+    this->tasks.push_back(std::move(task));
+    lock.unlock();
+    this->cv.notify_all();
+}
+
+void AsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->cv.wait(lock, [this] { return this->tasks.empty() && !this->busy; });
+    this->rethrow(lock);
+}
+
+bool AsyncWriter::pending() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return !this->tasks.empty() || this->busy;
+}
+
+void AsyncWriter::rethrow(std::unique_lock<std::mutex>& lock) {
+    if (!this->error)
+        return;
+
+    auto error_ptr = std::exchange(this->error, nullptr);
+    lock.unlock();
+    std::rethrow_exception(error_ptr);
+}
+
+void AsyncWriter::run() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (true) {
+        this->cv.wait(lock, [this] { return this->stop || !this->tasks.empty(); });
+        if (this->tasks.empty())
+            return;
+
+        auto task = std::move(this->tasks.front());
+        this->tasks.pop_front();
+        this->busy = true;
+        lock.unlock();
+
+        std::exception_ptr task_error;
+        try {
+            task();
+        } catch (...) {
+            task_error = std::current_exception();
+        }
+
+        // Release the snapshot owned by the task before signalling that
+        // the slot is available.
+        task = nullptr;
+
+        lock.lock();
+        this->busy = false;
+        if (task_error && !this->error)
+            this->error = task_error;
+
+        this->cv.notify_all();
+    }
+}
+
 }
 
 namespace Opm {
@@ -114,6 +240,20 @@ class EclipseIO::Impl {
 
         void recordSummaryOutput(const double secs_elapsed);
 
+        void writeRestartAndRFT(const Action::State& action_state,
+                                const WellTestState& wtest_state,
+                                const SummaryState&  st,
+                                const UDQState&      udq_state,
+                                const int            report_step,
+                                const double         secs_elapsed,
+                                const bool           write_restart,
+                                const std::pair<bool, bool>& rft,
+                                RestartValue         value,
+                                const bool           write_double);
+
+        void prepareAsyncOutput();
+        void checkAsyncSchedule();
+
         const EclipseState& es;
         EclipseGrid grid;
         const Schedule& schedule;
@@ -124,6 +264,12 @@ class EclipseIO::Impl {
         bool output_enabled;
         std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
 
+        // Declared last to be destroyed - i.e. drained - first.
+        std::unique_ptr<AsyncWriter> async_writer{};
+
+        // Schedule generation of the most recently queued output.
+        std::size_t async_generation{0};
+
 private:
     mutable bool sumthin_active_{false};
     mutable bool sumthin_triggered_{false};
@@ -242,6 +388,91 @@ bool EclipseIO::Impl::summaryAtRptOnly(const int report_step) const
     return this->schedule[report_step - 1].rptonly();
 }
 
+void EclipseIO::Impl::writeRestartAndRFT(const Action::State&         action_state,
+                                         const WellTestState&         wtest_state,
+                                         const SummaryState&          st,
+                                         const UDQState&              udq_state,
+                                         const int                    report_step,
+                                         const double                 secs_elapsed,
+                                         const bool                   write_restart,
+                                         const std::pair<bool, bool>& rft,
+                                         RestartValue                 value,
+                                         const bool                   write_double)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    // RFT output only needs the well data, write it first so that the
+    // restart output can take over the rest of the RestartValue.
+    if (const auto& [wantRFT, haveExistingRFT] = rft; wantRFT) {
+        // Open existing RFT file if report step is after first RFT event.
+        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
+            haveExistingRFT
+        };
+
+        EclIO::OutputStream::RFT rftFile {
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            openExisting
+        };
+
+        RftIO::write(report_step, secs_elapsed, this->es.getUnits(),
+                     this->grid, this->schedule, value.wells, rftFile);
+    }
+
+    if (write_restart) {
+        EclIO::OutputStream::Restart rstFile {
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
+            report_step,
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
+        };
+
+        RestartIO::save(rstFile, report_step, secs_elapsed, std::move(value),
+                        this->es, this->grid, this->schedule, action_state,
+                        wtest_state, st, udq_state, this->aquiferData,
+                        write_double);
+    }
+}
+
+/*
+  The output thread reads the grid and the Schedule while the calling
+  thread writes the summary and the RPT reports.  The grid state which is
+  built lazily by the const getters is therefore built before any output
+  is queued, after which both threads only read the grid.
+*/
+void EclipseIO::Impl::prepareAsyncOutput()
+{
+    this->grid.buildGeometryCache();
+    this->grid.activeVolume();
+
+    this->async_generation = this->schedule.generation();
+}
+
+/*
+  The Schedule must not be modified while output is pending.  Pending
+  output only drains between two calls to writeTimeStep(), so if output is
+  still pending when a new generation is observed, it was also pending when
+  the Schedule was modified; the output is then completed and the error is
+  reported.
+*/
+void EclipseIO::Impl::checkAsyncSchedule()
+{
+    if (this->schedule.generation() == this->async_generation)
+        return;
+
+    if (this->async_writer->pending()) {
+        this->async_writer->flush();
+        throw std::logic_error {
+            "The Schedule was modified while restart or RFT output was pending. "
+            "Call EclipseIO::flush() before modifying the Schedule, e.g. by ACTIONX"
+        };
+    }
+
+    this->async_generation = this->schedule.generation();
+}
+
 /*
 int_data: Writes key(string) and integers vector to INIT file as eclipse keywords
 - Key: Max 8 chars.
@@ -280,10 +511,11 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    const auto& es = this->impl->es;
     const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
+
+    if (this->impl->async_writer)
+        this->impl->checkAsyncSchedule();
 
     if ((report_step > 0) &&
         this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed))
@@ -307,40 +539,30 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
       but there is an unsupported option to the RPTSCHED keyword which
       will request restart output from every timestep.
     */
-    if(!isSubstep && schedule.write_rst_file(report_step))
-    {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_step,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
-
-        RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
-    }
+    const bool write_restart = !isSubstep && schedule.write_rst_file(report_step);
 
     // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        // Open existing RFT file if report step is after first RFT event.
-        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
-            haveExistingRFT
-        };
-
-        EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
-        };
-
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+    const auto rft = this->impl->wantRFTOutput(report_step, isSubstep);
+
+    if (write_restart || rft.first) {
+        if (this->impl->async_writer) {
+            auto task = [impl = this->impl.get(),
+                         action_state, wtest_state, st, udq_state,
+                         report_step, secs_elapsed, write_restart, rft,
+                         value = std::move(value), write_double]() mutable
+            {
+                impl->writeRestartAndRFT(action_state, wtest_state, st, udq_state,
+                                         report_step, secs_elapsed, write_restart, rft,
+                                         std::move(value), write_double);
+            };
+
+            this->impl->async_writer->push(std::move(task));
+            this->impl->async_generation = schedule.generation();
+        }
+        else
+            this->impl->writeRestartAndRFT(action_state, wtest_state, st, udq_state,
+                                           report_step, secs_elapsed, write_restart, rft,
+                                           std::move(value), write_double);
     }
 
     if (!isSubstep) {
@@ -388,11 +610,51 @@ EclipseIO::EclipseIO( const EclipseState& es,
     ensure_directory_exists( this->impl->outputDir );
 }
 
+void EclipseIO::setAsyncOutput(const bool async_output) {
+    if (async_output == this->asyncOutput())
+        return;
+
+    if (async_output) {
+        // Double buffered; one snapshot being written and one waiting.
+        this->impl->prepareAsyncOutput();
+        this->impl->async_writer = std::make_unique<AsyncWriter>(2);
+        return;
+    }
+
+    auto writer = std::move(this->impl->async_writer);
+    writer->flush();
+}
+
+bool EclipseIO::asyncOutput() const {
+    return static_cast<bool>(this->impl->async_writer);
+}
+
+void EclipseIO::flush() {
+    if (! this->impl->async_writer)
+        return;
+
+    this->impl->checkAsyncSchedule();
+    this->impl->async_writer->flush();
+}
+
 const out::Summary& EclipseIO::summary() {
     return this->impl->summary;
 }
 
 
-EclipseIO::~EclipseIO() {}
+EclipseIO::~EclipseIO() {
+    if (! this->impl->async_writer)
+        return;
+
+    try {
+        this->impl->async_writer->flush();
+    }
+    catch (const std::exception& e) {
+        OpmLog::error(std::string { "Writing restart or RFT output failed: " } + e.what());
+    }
+    catch (...) {
+        OpmLog::error("Writing restart or RFT output failed");
+    }
+}
 
 } // namespace Opm
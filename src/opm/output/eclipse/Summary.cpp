@@ -54,6 +54,7 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 #include <opm/io/eclipse/ExtSmryOutput.hpp>
+#include <opm/io/eclipse/SummaryHistory.hpp>
 
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/GuideRateValue.hpp>
@@ -78,11 +79,14 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -468,19 +472,20 @@ struct quantity {
 struct fn_args
 {
     const std::vector<const Opm::Well*>& schedule_wells;
-    const std::string group_name;
-    const std::string keyword_name;
+    const std::string& group_name;
+    const std::string& keyword_name;
     double duration;
     const int sim_step;
     int  num;
-    const std::optional<std::variant<std::string, int>> extra_data;
+    const std::optional<std::variant<std::string, int>>& extra_data;
     const Opm::SummaryState& st;
     const Opm::data::Wells& wells;
     const Opm::data::GroupAndNetworkValues& grp_nwrk;
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    // Sorted by well name.
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -545,13 +550,13 @@ measure rate_unit<Opm::data::GuideRateValue::Item::ResV>() { return measure::rat
 
 double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name)
 {
-    auto it = std::find_if(eff_factors.begin(), eff_factors.end(),
-        [&name](const std::pair<std::string, double>& elem)
+    auto it = std::lower_bound(eff_factors.begin(), eff_factors.end(), name,
+        [](const std::pair<std::string, double>& elem, const std::string& key)
     {
-        return elem.first == name;
+        return elem.first < key;
     });
 
-    return (it != eff_factors.end()) ? it->second : 1.0;
+    return ((it != eff_factors.end()) && (it->first == name)) ? it->second : 1.0;
 }
 
 inline bool
@@ -2095,6 +2100,13 @@ static const std::unordered_map< std::string, ofun > funs = {
     { "ROEW", roew },
 };
 
+// The evaluation functions in funs which read other summary vectors from
+// the SummaryState; these are evaluated serially, after all the vectors
+// preceding them in the summary configuration have been stored.
+static const std::unordered_set<std::string> state_dependent_funs = {
+    "ROEW",
+};
+
 static const std::unordered_map< std::string, Opm::UnitSystem::measure> single_values_units = {
   {"TCPU"     , Opm::UnitSystem::measure::runtime },
   {"ELAPSED"  , Opm::UnitSystem::measure::identity },
@@ -2344,27 +2356,24 @@ bool need_wells(const Opm::EclIO::SummaryNode& node)
     throw std::runtime_error("Unhandled summary node category in need_wells");
 }
 
-void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+Opm::SummaryState::Handle
+summaryHandle(const Opm::EclIO::SummaryNode& node, Opm::SummaryState& st)
 {
     using Cat = Opm::EclIO::SummaryNode::Category;
 
     switch (node.category) {
     case Cat::Well:
-        st.update_well_var(node.wgname, node.keyword, value);
-        break;
+        return st.well_var_handle(node.wgname, node.keyword);
 
     case Cat::Group:
     case Cat::Node:
-        st.update_group_var(node.wgname, node.keyword, value);
-        break;
+        return st.group_var_handle(node.wgname, node.keyword);
 
     case Cat::Connection:
-        st.update_conn_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.conn_var_handle(node.wgname, node.keyword, node.number);
 
     default:
-        st.update(node.unique_key(), value);
-        break;
+        return st.handle(node.unique_key());
     }
 }
 
@@ -2435,6 +2444,9 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 
         this->factors.emplace_back(well->name(), eff_factor);
     }
+
+    // Sorted for efac() lookup.
+    std::sort(this->factors.begin(), this->factors.end());
 }
 
 namespace Evaluator {
@@ -2463,19 +2475,40 @@ namespace Evaluator {
     public:
         virtual ~Base() {}
 
+        // Called before the first update() of each report step, and again
+        // if the schedule has been modified or a different SummaryState is
+        // updated, to precompute whatever depends only on the report step.
+        virtual void prepare(const std::size_t   /* sim_step */,
+                             const InputData&    /* input */,
+                             Opm::SummaryState&  /* st */)
+        {}
+
         virtual void update(const std::size_t       sim_step,
                             const double            stepSize,
                             const InputData&        input,
                             const SimulatorResults& simRes,
                             Opm::SummaryState&      st) const = 0;
+
+        // Whether the evaluator supports concurrent evaluation through
+        // compute() and store().
+        virtual bool concurrent() const
+        {
+            return false;
+        }
     };
 
-    class FunctionRelation : public Base
+    /*
+      Base class for the evaluators which calculate one value for their
+      summary node. The calculation in compute() does not modify the
+      SummaryState, so these evaluators can be computed concurrently with
+      the values saved to the SummaryState afterwards - in the original
+      order - with store().
+    */
+    class NodeValue : public Base
     {
     public:
-        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
+        explicit NodeValue(Opm::EclIO::SummaryNode node)
             : node_(std::move(node))
-            , fcn_ (std::move(fcn))
         {}
 
         void update(const std::size_t       sim_step,
@@ -2484,81 +2517,183 @@ namespace Evaluator {
                     const SimulatorResults& simRes,
                     Opm::SummaryState&      st) const override
         {
-            const auto get_wells = need_wells(this->node_);
+            const auto value = this->compute(sim_step, stepSize, input, simRes, st);
+            if (value.has_value())
+                this->store(*value, st);
+        }
 
-            const auto wells = get_wells
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
+        void prepare(const std::size_t  /* sim_step */,
+                     const InputData&   /* input */,
+                     Opm::SummaryState& st) override
+        {
+            this->handle_ = summaryHandle(this->node_, st);
+        }
+
+        bool concurrent() const override
+        {
+            return true;
+        }
+
+        // Returns the value in output units, or nullopt if the node should
+        // not be updated.
+        virtual std::optional<double>
+        compute(const std::size_t        sim_step,
+                const double             stepSize,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& st) const = 0;
+
+        void store(const double value, Opm::SummaryState& st) const
+        {
+            if (this->handle_.valid())
+                st.update(this->handle_, value);
+            else
+                st.update(summaryHandle(this->node_, st), value);
+        }
+
+    protected:
+        Opm::EclIO::SummaryNode node_;
 
-            if (get_wells && wells.empty())
+    private:
+        // Resolved in prepare(), valid for the SummaryState passed there.
+        Opm::SummaryState::Handle handle_{};
+    };
+
+    class FunctionRelation : public NodeValue
+    {
+    public:
+        explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn, const bool reads_state)
+            : NodeValue   (std::move(node))
+            , fcn_        (std::move(fcn))
+            , reads_state_(reads_state)
+            , need_wells_ (need_wells(this->node_))
+            , group_name_(group_name(this->node_))
+            , extra_data_(this->node_.fip_region)
+        {}
+
+        void prepare(const std::size_t  sim_step,
+                     const InputData&   input,
+                     Opm::SummaryState& st) override
+        {
+            NodeValue::prepare(sim_step, input, st);
+            this->plan_ = this->makePlan(sim_step, input);
+        }
+
+        bool concurrent() const override
+        {
+            return ! this->reads_state_;
+        }
+
+        std::optional<double>
+        compute(const std::size_t        sim_step,
+                const double             stepSize,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& st) const override
+        {
+            // The plan is normally prepared once per report step, fall back
+            // to a temporary plan if that has not been done.
+            std::optional<Plan> local_plan{};
+            if (! this->plan_.has_value() || ! this->plan_->current(sim_step, input.sched))
+                local_plan = this->makePlan(sim_step, input);
+
+            const auto& plan = local_plan.has_value() ? *local_plan : *this->plan_;
+            if (this->need_wells_ && plan.wells.empty())
                 // Parameter depends on well information, but no active
                 // wells apply at this sim_step.  Nothing to do.
-                return;
-
-            EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
+                return std::nullopt;
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword, stepSize, static_cast<int>(sim_step),
+                plan.wells, this->group_name_, this->node_.keyword, stepSize, static_cast<int>(sim_step),
                 std::max(0, this->node_.number),
-                this->node_.fip_region,
+                this->extra_data_,
                 st, simRes.wellSol, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(efac.factors), input.initial_inplace, simRes.inplace,
+                plan.factors, input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
 
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            return usys.from_si(prm.unit, prm.value);
         }
 
     private:
-        Opm::EclIO::SummaryNode node_;
+        // The wells and efficiency factors of the node at one report step.
+        struct Plan
+        {
+            std::size_t sim_step;
+            std::size_t generation;
+            std::vector<const Opm::Well*> wells;
+            EfficiencyFactor::FacColl factors;
+
+            bool current(const std::size_t step, const Opm::Schedule& sched) const
+            {
+                return (this->sim_step == step) && (this->generation == sched.generation());
+            }
+        };
+
         ofun                    fcn_;
+        bool                    reads_state_;
+        bool                    need_wells_;
+        std::string             group_name_;
+        std::optional<std::variant<std::string, int>> extra_data_;
+        std::optional<Plan>     plan_{};
 
-        std::string group_name() const
+        Plan makePlan(const std::size_t sim_step, const InputData& input) const
+        {
+            auto wells = this->need_wells_
+                ? find_wells(input.sched, this->node_,
+                             static_cast<int>(sim_step), input.reg)
+                : std::vector<const Opm::Well*>{};
+
+            EfficiencyFactor efac{};
+            efac.setFactors(this->node_, input.sched, wells, sim_step);
+
+            return { sim_step, input.sched.generation(), std::move(wells), std::move(efac.factors) };
+        }
+
+        static std::string group_name(const Opm::EclIO::SummaryNode& node)
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
 
             const auto need_grp_name =
-                (this->node_.category == Cat::Group) ||
-                (this->node_.category == Cat::Node);
+                (node.category == Cat::Group) ||
+                (node.category == Cat::Node);
 
             return need_grp_name
-                ? this->node_.wgname : std::string{""};
+                ? node.wgname : std::string{""};
         }
 
     };
 
-    class BlockValue : public Base
+    class BlockValue : public NodeValue
     {
     public:
         explicit BlockValue(Opm::EclIO::SummaryNode node,
                             const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        compute(const std::size_t     /* sim_step */,
+                const double          /* stepSize */,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            return usys.from_si(this->m_, xPos->second);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         Opm::out::Summary::BlockValues::key_type lookupKey() const
@@ -2567,68 +2702,68 @@ namespace Evaluator {
         }
     };
 
-    class AquiferValue: public Base
+    class AquiferValue : public NodeValue
     {
     public:
         explicit AquiferValue(Opm::EclIO::SummaryNode node,
                               const Opm::UnitSystem::measure m)
-        : node_(std::move(node))
-        , m_   (m)
+        : NodeValue(std::move(node))
+        , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        compute(const std::size_t     /* sim_step */,
+                const double          /* stepSize */,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
-                return;
+                return std::nullopt;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            return usys.from_si(this->m_, xPos->second.get(this->node_.keyword));
         }
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
-    class RegionValue : public Base
+    class RegionValue : public NodeValue
     {
     public:
         explicit RegionValue(Opm::EclIO::SummaryNode node,
                              const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        compute(const std::size_t     /* sim_step */,
+                const double          /* stepSize */,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& /* st */) const override
         {
             if (this->node_.number < 0)
-                return;
+                return std::nullopt;
 
             auto xPos = simRes.region.find(this->node_.keyword);
             if (xPos == simRes.region.end())
-                return;
+                return std::nullopt;
 
             const auto ix = this->index();
             if (ix >= xPos->second.size())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
 
         std::vector<double>::size_type index() const
@@ -2637,33 +2772,33 @@ namespace Evaluator {
         }
     };
 
-    class GlobalProcessValue : public Base
+    class GlobalProcessValue : public NodeValue
     {
     public:
         explicit GlobalProcessValue(Opm::EclIO::SummaryNode node,
                                     const Opm::UnitSystem::measure m)
-            : node_(std::move(node))
-            , m_   (m)
+            : NodeValue(std::move(node))
+            , m_       (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::optional<double>
+        compute(const std::size_t     /* sim_step */,
+                const double          /* stepSize */,
+                const InputData&         input,
+                const SimulatorResults&  simRes,
+                const Opm::SummaryState& /* st */) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
-                return;
+                return std::nullopt;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            return usys.from_si(this->m_, val);
         }
 
     private:
-        Opm::EclIO::SummaryNode  node_;
         Opm::UnitSystem::measure m_;
     };
 
@@ -2831,6 +2966,7 @@ namespace Evaluator {
 
         Opm::UnitSystem::measure paramUnit_;
         ofun paramFunction_;
+        bool paramReadsState_{false};
 
         Descriptor functionRelation();
         Descriptor blockValue();
@@ -2883,7 +3019,7 @@ namespace Evaluator {
 
         desc.unit = this->functionUnitString();
         desc.evaluator.reset(new FunctionRelation {
-            *this->node_, std::move(this->paramFunction_)
+            *this->node_, std::move(this->paramFunction_), this->paramReadsState_
         });
 
         return desc;
@@ -3021,6 +3157,7 @@ namespace Evaluator {
             // 'node_' represents a functional relation.
             // Capture evaluation function and return true.
             this->paramFunction_ = pos->second;
+            this->paramReadsState_ = state_dependent_funs.count(pos->first) > 0;
             return true;
         }
 
@@ -3034,6 +3171,7 @@ namespace Evaluator {
             // 'node_' represents a functional relation.
             // Capture evaluation function and return true.
             this->paramFunction_ = pos->second;
+            this->paramReadsState_ = state_dependent_funs.count(pos->first) > 0;
             return true;
         }
 
@@ -3053,6 +3191,7 @@ namespace Evaluator {
                     pos = funs.find(tracer_tag);
                     if (pos != funs.end()) {
                         this->paramFunction_ = pos->second;
+                        this->paramReadsState_ = state_dependent_funs.count(pos->first) > 0;
                         return true;
                     }
 
@@ -3351,7 +3490,6 @@ private:
         int id{0};
         int seq{-1};
         bool isSubstep{false};
-        std::vector<float> params{};
     };
 
     using EvalPtr = SummaryOutputParameters::EvalPtr;
@@ -3371,9 +3509,21 @@ private:
     mutable int miniStepID_{0};
     mutable double prevEvalTime_{std::numeric_limits<double>::lowest()};
 
+    // Report step, schedule generation and SummaryState layout for which
+    // the evaluators were last prepared.
+    mutable std::optional<std::tuple<int, std::size_t, std::size_t>> preparedStep_{};
+
+    // Evaluators which support concurrent evaluation, nullptr for the
+    // evaluators which must be updated serially.  Indexed as the
+    // evaluators of outputParameters_.
+    mutable std::vector<const Evaluator::NodeValue*> concurrentEvaluators_{};
+
+    // Minimum number of evaluators for which evaluation in parallel pays
+    // off.
+    static constexpr int minParallelEvaluators = 256;
+
     int prevCreate_{-1};
     int prevReportStepID_{-1};
-    std::vector<MiniStep>::size_type numUnwritten_{0};
 
     SummaryOutputParameters                  outputParameters_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
@@ -3381,6 +3531,11 @@ private:
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
 
+    // Parameter values of the unwritten ministeps, one row per element of
+    // unwritten_, and the row buffer used when outputting them.
+    Opm::EclIO::SummaryHistory unwrittenParams_{};
+    std::vector<float>         params_{};
+
     std::unique_ptr<Opm::EclIO::OutputStream::SummarySpecification> smspec_{};
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
 
@@ -3399,10 +3554,7 @@ private:
 
     void configureUDQ(const EclipseState& es, const SummaryConfig& summary_config, const Schedule& sched);
 
-    MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
-    const MiniStep& lastUnwritten() const;
-
-    void write(const MiniStep& ms);
+    void write(const MiniStep& ms, const std::vector<float>& params);
 
     void createSMSpecIfNecessary();
     void createSmryStreamIfNecessary(const int report_step);
@@ -3439,6 +3591,8 @@ SummaryImplementation(const EclipseState&  es,
                                              sched, evaluatorFactory);
     this->configureUDQ(es, sumcfg, sched);
 
+    this->unwrittenParams_ = Opm::EclIO::SummaryHistory(this->valueKeys_, 8);
+
     for (const auto& config_node : sumcfg.keywords("WBP*"))
         this->wbp_wells.insert( config_node.namedEntity() );
 
@@ -3457,18 +3611,25 @@ SummaryImplementation(const EclipseState&  es,
 void Opm::out::Summary::SummaryImplementation::
 internal_store(const SummaryState& st, const int report_step, bool isSubstep)
 {
-    auto& ms = this->getNextMiniStep(report_step, isSubstep);
-
     const auto nParam = this->valueKeys_.size();
 
+    this->params_.assign(nParam, 0.0f);
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
         if (! st.has(this->valueKeys_[i]))
             // Parameter not yet evaluated (e.g., well/group not
             // yet active).  Nothing to do here.
             continue;
 
-        ms.params[i] = st.get(this->valueKeys_[i]);
+        this->params_[i] = st.get(this->valueKeys_[i]);
     }
+
+    // MINISTEP IDs start at zero.  The unwritten ministeps are keyed by
+    // their ID rather than by the elapsed time of the SummaryState, which
+    // is not required to increase between calls to add_timestep().
+    const auto id = this->miniStepID_ - 1;
+    this->unwritten_.push_back({ id, report_step, isSubstep });
+    this->unwrittenParams_.append(id, this->params_);
 }
 
 Opm::PAvgCalculatorCollection
@@ -3518,8 +3679,60 @@ eval(const int                          sim_step,
         well_solution, grp_nwrk_solution, single_values, inplace, region_values, block_values, aquifer_values
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    const auto step = std::make_tuple(sim_step, this->sched_.get().generation(), st.layout_id());
+    if (this->preparedStep_ != step) {
+        this->concurrentEvaluators_.clear();
+        for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
+            evalPtr->prepare(sim_step, input, st);
+
+            this->concurrentEvaluators_.push_back(evalPtr->concurrent()
+                ? dynamic_cast<const Evaluator::NodeValue*>(evalPtr.get())
+                : nullptr);
+        }
+
+        for (auto& [_, evalPtr] : this->extra_parameters) {
+            (void)_;
+            evalPtr->prepare(sim_step, input, st);
+        }
+
+        this->preparedStep_ = step;
+    }
+
+    // The values of the concurrent evaluators are computed in parallel,
+    // and then stored in the SummaryState in the same order as the serial
+    // evaluators are updated.  The resulting SummaryState is therefore
+    // identical to the one produced by a purely serial evaluation.
+    const auto& evaluators = this->outputParameters_.getEvaluators();
+    const auto  numEval    = static_cast<int>(evaluators.size());
+
+    std::vector<std::optional<double>> values(evaluators.size());
+    std::exception_ptr error{};
+
+#pragma omp parallel for schedule(dynamic, 16) if(numEval >= minParallelEvaluators)
+    for (int i = 0; i < numEval; ++i) {
+        const auto* evaluator = this->concurrentEvaluators_[i];
+        if (evaluator == nullptr)
+            continue;
+
+        try {
+            values[i] = evaluator->compute(sim_step, duration, input, simRes, st);
+        }
+        catch (...) {
+#pragma omp critical
+            if (! error)
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    for (int i = 0; i < numEval; ++i) {
+        const auto* evaluator = this->concurrentEvaluators_[i];
+        if (evaluator == nullptr)
+            evaluators[i]->update(sim_step, duration, input, simRes, st);
+        else if (values[i].has_value())
+            evaluator->store(*values[i], st);
     }
 
     for (auto& [_, evalPtr] : this->extra_parameters) {
@@ -3537,8 +3750,7 @@ eval(const int                          sim_step,
 
 void Opm::out::Summary::SummaryImplementation::write()
 {
-    const auto zero = std::vector<MiniStep>::size_type{0};
-    if (this->numUnwritten_ == zero)
+    if (this->unwritten_.empty())
         // No unwritten data.  Nothing to do so return early.
         return;
 
@@ -3546,28 +3758,34 @@ void Opm::out::Summary::SummaryImplementation::write()
 
     this->createSMSpecIfNecessary();
 
-    if (this->prevReportStepID_ < this->lastUnwritten().seq) {
+    if (this->prevReportStepID_ < this->unwritten_.back().seq) {
         this->smspec_->write(this->outputParameters_.summarySpecification());
     }
 
-    for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i)
-        this->write(this->unwritten_[i]);
+    for (auto i = 0*this->unwritten_.size(); i < this->unwritten_.size(); ++i) {
+        this->unwrittenParams_.row(i, this->params_);
+        this->write(this->unwritten_[i], this->params_);
+    }
 
     // Eagerly output last set of parameters to permanent storage.
     this->stream_->flushStream();
 
     if (this->esmry_ != nullptr){
-        for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i){
-            this->esmry_->write(this->unwritten_[i].params, !this->unwritten_[i].isSubstep);
+        for (auto i = 0*this->unwritten_.size(); i < this->unwritten_.size(); ++i){
+            this->unwrittenParams_.row(i, this->params_);
+            this->esmry_->write(this->params_, !this->unwritten_[i].isSubstep);
         }
+
+        this->esmry_->flush();
     }
 
-    // Reset "unwritten" counter to reflect the fact that we've
-    // output all stored ministeps.
-    this->numUnwritten_ = zero;
+    // Forget the output ministeps.  The history keeps its storage for
+    // the next batch of ministeps.
+    this->unwritten_.clear();
+    this->unwrittenParams_.clear();
 }
 
-void Opm::out::Summary::SummaryImplementation::write(const MiniStep& ms)
+void Opm::out::Summary::SummaryImplementation::write(const MiniStep& ms, const std::vector<float>& params)
 {
     this->createSmryStreamIfNecessary(ms.seq);
 
@@ -3579,7 +3797,7 @@ void Opm::out::Summary::SummaryImplementation::write(const MiniStep& ms)
     }
 
     this->stream_->write("MINISTEP", std::vector<int>{ ms.id });
-    this->stream_->write("PARAMS"  , ms.params);
+    this->stream_->write("PARAMS"  , params);
 }
 
 void
@@ -3803,7 +4021,7 @@ void Opm::out::Summary::SummaryImplementation::configureUDQ(const EclipseState&
 
         auto fun_pos = funs.find(node.keyword);
         if (fun_pos != funs.end()) {
-            this->extra_parameters.emplace(node.unique_key(), std::make_unique<Evaluator::FunctionRelation>(node, fun_pos->second));
+            this->extra_parameters.emplace(node.unique_key(), std::make_unique<Evaluator::FunctionRelation>(node, fun_pos->second, state_dependent_funs.count(node.keyword) > 0));
             continue;
         }
 
@@ -3867,37 +4085,6 @@ configureRequiredRestartParameters(const SummaryConfig& sumcfg,
     }
 }
 
-Opm::out::Summary::SummaryImplementation::MiniStep&
-Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step, bool isSubstep)
-{
-    if (this->numUnwritten_ == this->unwritten_.size())
-        this->unwritten_.emplace_back();
-
-    assert ((this->numUnwritten_ < this->unwritten_.size()) &&
-            "Internal inconsistency in 'unwritten' counter");
-
-    auto& ms = this->unwritten_[this->numUnwritten_++];
-
-    ms.id  = this->miniStepID_ - 1;  // MINISTEP IDs start at zero.
-    ms.seq = report_step;
-    ms.isSubstep = isSubstep;
-
-    ms.params.resize(this->valueKeys_.size(), 0.0f);
-
-    std::fill(ms.params.begin(), ms.params.end(), 0.0f);
-
-    return ms;
-}
-
-const Opm::out::Summary::SummaryImplementation::MiniStep&
-Opm::out::Summary::SummaryImplementation::lastUnwritten() const
-{
-    assert (this->numUnwritten_ <= this->unwritten_.size());
-    assert (this->numUnwritten_ >  decltype(this->numUnwritten_){0});
-
-    return this->unwritten_[this->numUnwritten_ - 1];
-}
-
 void Opm::out::Summary::SummaryImplementation::createSMSpecIfNecessary()
 {
     if (this->deferredSMSpec_) {
@@ -346,19 +346,26 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
-
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
+
+        // The geometry is calculated in one parallel pass directly into the
+        // output arrays, without enabling the geometry cache of the grid.
+        // A cache configured by the caller is built up front, since the
+        // lazy build in the geometry getters is not thread safe.
+        grid.buildGeometryCache();
+
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t cell = 0; cell < static_cast<std::ptrdiff_t>(nAct); ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
         }
 
         initFile.write("DEPTH", depth);
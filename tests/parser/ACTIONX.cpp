@@ -733,6 +733,65 @@ BOOST_AUTO_TEST_CASE(TestWLIST) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestProgram) {
+    const std::vector<std::vector<std::string>> conditions = {
+        {"WOPR", "*", ">", "1.0", "AND", "WWCT", "*", "<", "0.50"},
+        {"WOPR", "*", ">", "1.0", "OR", "WWCT", "*", "<", "0.50"},
+        {"WOPR", "'OP*'", ">", "1.0", "OR", "FOPR", ">", "100"},
+        {"FOPR", ">", "100", "AND", "WOPR", "*LIST1", ">", "1.0"},
+        {"(", "FOPR", "<", "100", "AND", "WWCT", "'OPX'", ">", "0.5", ")", "OR", "WOPR", "'OP*'", ">", "0.25"},
+        {"MNTH", ">", "JAN", "AND", "WWCT", "*", "<", "0.5"},
+        {"MNTH", "=", "4.3", "OR", "WOPR", "*LIST1", "<", "1"},
+    };
+
+    SummaryState st(TimeService::now());
+    st.update("FOPR", 50);
+    st.update("MNTH", 4);
+    st.update_well_var("OPX", "WOPR", 0);
+    st.update_well_var("OPY", "WOPR", 0.50);
+    st.update_well_var("OPZ", "WOPR", 2.0);
+    st.update_well_var("OPX", "WWCT", 1.0);
+    st.update_well_var("OPY", "WWCT", 0.0);
+    st.update_well_var("OPZ", "WWCT", 1.0);
+
+    WListManager wlm;
+    wlm.newList("*LIST1", {"OPX", "OPZ"});
+    Action::Context context(st, wlm);
+
+    auto check = [&context](const Action::AST& ast) {
+        const auto res = ast.eval(context);
+        const auto ref = ast.eval_tree(context);
+        BOOST_CHECK_EQUAL(static_cast<bool>(res), static_cast<bool>(ref));
+        if (res && ref) {
+            auto wells = res.wells();
+            auto ref_wells = ref.wells();
+            std::sort(wells.begin(), wells.end());
+            std::sort(ref_wells.begin(), ref_wells.end());
+            BOOST_CHECK_EQUAL_COLLECTIONS(wells.begin(), wells.end(), ref_wells.begin(), ref_wells.end());
+        }
+    };
+
+    std::vector<Action::AST> asts;
+    for (const auto& tokens : conditions)
+        asts.emplace_back(tokens);
+
+    for (const auto& ast : asts)
+        check(ast);
+
+    // New wells, new values and a changed well list are picked up by the
+    // compiled programs.
+    st.update("FOPR", 150);
+    st.update("MNTH", 1);
+    st.update_well_var("OPW", "WOPR", 5.0);
+    st.update_well_var("OPW", "WWCT", 0.1);
+    st.update_well_var("OPX", "WOPR", 3.0);
+    wlm.newList("*LIST1", {"OPW", "OPY"});
+    for (const auto& ast : asts)
+        check(ast);
+
+    BOOST_CHECK_THROW(Action::AST({"WOPR", "'OPQ'", ">", "1"}).eval(context), std::exception);
+}
+
 BOOST_AUTO_TEST_CASE(TestFieldAND) {
     Action::AST ast({"FMWPR", ">=", "4", "AND", "WUPR3", "OP*", "=", "1"});
     SummaryState st(TimeService::now());
@@ -1662,3 +1721,93 @@ ENDACTIO
     auto st = SummaryState{ TimeService::now() };
     BOOST_CHECK_THROW( make_schedule(deck_string), std::exception);
 }
+
+BOOST_AUTO_TEST_CASE(ActionX_IncrementalReplay) {
+    const auto deck_string = std::string{ R"(
+GRID
+
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+
+SCHEDULE
+
+WELSPECS
+    'P1' 'G1'  1 1 10 'OIL' /
+    'P2' 'G2'  2 2 10 'OIL' /
+/
+
+COMPDAT
+    'P1'  1  1   1   1 'OPEN' /
+    'P2'  2  2   1   1 'OPEN' /
+/
+
+WCONPROD
+    'P1' 'OPEN' 'ORAT' 100 /
+    'P2' 'OPEN' 'ORAT' 100 /
+/
+
+ACTIONX
+'A' /
+WWCT 'P1' > 0.75 /
+/
+
+WCONPROD
+    'P1' 'OPEN' 'ORAT' 50 /
+/
+
+ENDACTIO
+
+TSTEP
+10 /
+
+WCONPROD
+    'P2' 'OPEN' 'ORAT' 200 /
+/
+
+TSTEP
+10 /
+
+WCONPROD
+    'P1' 'OPEN' 'ORAT' 300 /
+/
+
+TSTEP
+10 10 /
+)"};
+
+    auto sched = make_schedule(deck_string);
+    auto reference = make_schedule(deck_string);
+    const auto& action1 = sched[0].actions.get()["A"];
+
+    sched.applyAction(0, TimeService::now(), action1, Action::Result{true}, {});
+
+    // The reference applies the same keywords and processes the whole
+    // remaining Schedule section again.
+    std::vector<DeckKeyword> action_keywords(action1.begin(), action1.end());
+    std::vector<DeckKeyword*> keywords;
+    for (auto& keyword : action_keywords)
+        keywords.push_back(&keyword);
+    reference.applyKeywords(keywords, 0);
+
+    BOOST_CHECK_EQUAL(sched.size(), reference.size());
+    for (std::size_t step = 0; step < sched.size(); step++) {
+        for (const auto& wname : {"P1", "P2"})
+            BOOST_CHECK(sched.getWell(wname, step) == reference.getWell(wname, step));
+    }
+
+    auto oil_rate = [&sched](const std::string& wname, std::size_t step) {
+        return sched.getWell(wname, step).getProductionProperties().OilRate.get<double>();
+    };
+
+    BOOST_CHECK_CLOSE(oil_rate("P1", 1), 50, 1e-5);
+    BOOST_CHECK_CLOSE(oil_rate("P2", 1), 200, 1e-5);
+    BOOST_CHECK_CLOSE(oil_rate("P1", 2), 300, 1e-5);
+    BOOST_CHECK_CLOSE(oil_rate("P1", 4), 300, 1e-5);
+    BOOST_CHECK_CLOSE(oil_rate("P2", 4), 200, 1e-5);
+}
@@ -174,6 +174,48 @@ BOOST_AUTO_TEST_CASE(ActiveCompletions) {
     BOOST_CHECK_EQUAL( completion3, active_completions.get(1));
 }
 
+BOOST_AUTO_TEST_CASE(ConnectionIndex) {
+    Opm::EclipseGrid grid(10,20,20);
+    auto dir = Opm::Connection::Direction::Z;
+    const auto kind = Opm::Connection::CTFKind::Defaulted;
+    Opm::WellConnections completions(Opm::Connection::Order::DEPTH, 0,0);
+    Opm::Connection completion1( 0,0,2, grid.getGlobalIndex(0,0,2), 1, 30.0, Opm::Connection::State::OPEN , 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 0, true);
+    Opm::Connection completion2( 0,0,0, grid.getGlobalIndex(0,0,0), 2, 10.0, Opm::Connection::State::SHUT , 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 0, true);
+    Opm::Connection completion3( 0,0,1, grid.getGlobalIndex(0,0,1), 3, 20.0, Opm::Connection::State::SHUT , 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 0, true);
+
+    completions.add( completion1 );
+    completions.add( completion2 );
+    completions.add( completion3 );
+    BOOST_CHECK_EQUAL( completion2, completions.getFromIJK(0,0,0) );
+    BOOST_CHECK_EQUAL( completion1, completions.getFromGlobalIndex(grid.getGlobalIndex(0,0,2)) );
+    BOOST_CHECK( !completions.hasGlobalIndex(grid.getGlobalIndex(1,0,0)) );
+    BOOST_CHECK_THROW( completions.getFromIJK(1,0,0), std::runtime_error );
+
+    // The index must follow the connections when they are reordered.
+    completions.order();
+    BOOST_CHECK_EQUAL( completion2, completions.get(0) );
+    BOOST_CHECK_EQUAL( completion1, completions.getFromIJK(0,0,2) );
+    BOOST_CHECK_EQUAL( completion3, completions.getFromGlobalIndex(grid.getGlobalIndex(0,0,1)) );
+
+    const auto positions = completions.findGlobalIndices({ grid.getGlobalIndex(0,0,2),
+                                                           grid.getGlobalIndex(5,5,5),
+                                                           grid.getGlobalIndex(0,0,0) });
+    BOOST_CHECK_EQUAL( positions.size(), 3U );
+    BOOST_CHECK_EQUAL( positions[0], 2U );
+    BOOST_CHECK_EQUAL( positions[1], completions.size() );
+    BOOST_CHECK_EQUAL( positions[2], 0U );
+
+    std::vector<int> global_cell;
+    for (int g = 1; g < static_cast<int>(grid.getCartesianSize()); ++g)
+        global_cell.push_back(g);
+
+    completions.filter(Opm::ActiveGridCells { 10, 20, 20, global_cell.data(), global_cell.size() });
+    BOOST_CHECK_EQUAL( completions.size(), 2U );
+    BOOST_CHECK( !completions.hasGlobalIndex(grid.getGlobalIndex(0,0,0)) );
+    BOOST_CHECK_EQUAL( completion3, completions.getFromIJK(0,0,1) );
+    BOOST_CHECK_EQUAL( completion1, completions.getFromGlobalIndex(grid.getGlobalIndex(0,0,2)) );
+}
+
 BOOST_AUTO_TEST_CASE(loadCOMPDATTEST) {
     Opm::UnitSystem units(Opm::UnitSystem::UnitType::UNIT_TYPE_METRIC); // Unit system used in deck FIRST_SIM.DATA.
     {
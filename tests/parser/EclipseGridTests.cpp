@@ -2468,6 +2468,50 @@ BOOST_AUTO_TEST_CASE(TEST_getCellCenters) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(GeometryCache) {
+    Opm::Deck deck = BAD_CP_GRID();
+    const Opm::EclipseGrid grid( deck );
+    const auto nCells = grid.getCartesianSize();
+
+    std::vector<std::array<double, 3>> centers, dims;
+    std::vector<double> depth, thickness, volume;
+    for (std::size_t g = 0; g < nCells; g++) {
+        centers.push_back(grid.getCellCenter(g));
+        dims.push_back(grid.getCellDims(g));
+        depth.push_back(grid.getCellDepth(g));
+        thickness.push_back(grid.getCellThickness(g));
+        volume.push_back(grid.getCellVolume(g));
+    }
+
+    BOOST_CHECK( grid.geometryCache() == Opm::EclipseGrid::GeometryCache::None );
+    grid.setGeometryCache(Opm::EclipseGrid::GeometryCache::Double);
+    for (std::size_t g = 0; g < nCells; g++) {
+        BOOST_CHECK( grid.getCellCenter(g) == centers[g] );
+        BOOST_CHECK( grid.getCellDims(g) == dims[g] );
+        BOOST_CHECK_EQUAL( grid.getCellDepth(g), depth[g] );
+        BOOST_CHECK_EQUAL( grid.getCellThickness(g), thickness[g] );
+        BOOST_CHECK_EQUAL( grid.getCellVolume(g), volume[g] );
+    }
+
+    grid.releaseGeometryCache();
+    BOOST_CHECK( grid.geometryCache() == Opm::EclipseGrid::GeometryCache::Double );
+    BOOST_CHECK_EQUAL( grid.getCellDepth(3), depth[3] );
+
+    grid.setGeometryCache(Opm::EclipseGrid::GeometryCache::Float);
+    grid.buildGeometryCache();
+    for (std::size_t g = 0; g < nCells; g++) {
+        for (std::size_t d = 0; d < 3; d++) {
+            BOOST_CHECK_CLOSE( grid.getCellCenter(g)[d], centers[g][d], 1e-4 );
+            BOOST_CHECK_CLOSE( grid.getCellDims(g)[d], dims[g][d], 1e-4 );
+        }
+        BOOST_CHECK_EQUAL( grid.getCellDepth(g), static_cast<float>(depth[g]) );
+        BOOST_CHECK_EQUAL( grid.getCellVolume(g), static_cast<float>(volume[g]) );
+    }
+
+    grid.setGeometryCache(Opm::EclipseGrid::GeometryCache::None);
+    BOOST_CHECK_EQUAL( grid.getCellDepth(3), depth[3] );
+}
+
 BOOST_AUTO_TEST_CASE(LoadFromBinary) {
     BOOST_CHECK_THROW(Opm::EclipseGrid( "No/does/not/exist" ) , std::runtime_error);
 }
@@ -2421,6 +2421,57 @@ COPYREG
     }
 }
 
+BOOST_AUTO_TEST_CASE(REGION_OPERATION_UPDATED_REGION) {
+    std::string deck_string = R"(
+GRID
+
+PERMX
+   20*1 /
+
+MULTNUM
+  10*1 10*2 /
+
+EDIT
+
+MULTIREG
+   PERMX 2 1 M/
+/
+
+EQUALS
+   MULTNUM 3 1 5 1 1 1 2 /
+/
+
+MULTIREG
+   PERMX 10 3 M/
+/
+
+ADDREG
+   PERMX 1 7 M/
+/
+
+)";
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+    EclipseGrid grid(10, 1, 2);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fp(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& permx = fp.get_double("PERMX");
+    for (std::size_t g = 0; g < 20; g++) {
+        // The first five cells in each layer are moved to region 3 after
+        // the first MULTIREG, region 7 is empty.
+        double expected = 1;
+        if (g < 5)
+            expected = 20;
+        else if (g < 10)
+            expected = 2;
+        else if (g < 15)
+            expected = 10;
+
+        BOOST_CHECK_CLOSE(to_si(expected), permx[g], 1e-5);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(OPERATE_RADIAL_PERM) {
     std::string deck_string = R"(
 GRID
@@ -135,3 +135,32 @@ IMPORT
     BOOST_CHECK( !deck.hasKeyword<ParserKeywords::IMPORT>() );
 
 }
+
+
+BOOST_AUTO_TEST_CASE(ImportDeckCache) {
+    WorkArea work;
+    {
+        std::ofstream data("CASE.DATA");
+        data << "RUNSPEC\nDIMENS\n 10 10 1 /\nGRID\nIMPORT\n 'PROPS' /\n";
+    }
+    auto write_import = [](double poro) {
+        EclIO::EclOutput output {"PROPS", false};
+        output.write<double>("PORO", std::vector<double>(100, poro));
+    };
+    write_import(0.25);
+
+    Parser parser;
+    parser.setDeckCache("cache");
+
+    const auto deck1 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(deck1.tree().includes("CASE.DATA", "PROPS"));
+    BOOST_CHECK_EQUAL(deck1.tree().files().size(), 2U);
+    BOOST_CHECK_EQUAL(deck1.get<ParserKeywords::PORO>().back().getRecord(0).getItem(0).getSIDouble(0), 0.25);
+
+    const auto deck2 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(deck1 == deck2);
+
+    write_import(0.30);
+    const auto deck3 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(deck3.get<ParserKeywords::PORO>().back().getRecord(0).getItem(0).getSIDouble(0), 0.30);
+}
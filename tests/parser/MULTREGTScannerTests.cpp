@@ -254,6 +254,48 @@ BOOST_AUTO_TEST_CASE(DefaultedRegions) {
 }
 
 
+BOOST_AUTO_TEST_CASE(RegionMultipliersBatch) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+  std::vector<const Opm::DeckKeyword*> keywords;
+  for (const auto& multregt : deck["MULTREGT"])
+      keywords.push_back( &multregt );
+  Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+
+  std::vector<std::size_t> cell1, cell2;
+  std::vector<Opm::FaceDir::DirEnum> faceDir;
+  for (std::size_t k = 0; k < 2; k++) {
+      for (std::size_t j = 0; j < 3; j++) {
+          for (std::size_t i = 0; i < 3; i++) {
+              const auto g = grid.getGlobalIndex(i,j,k);
+              if (i < 2) {
+                  cell1.push_back(g); cell2.push_back(grid.getGlobalIndex(i+1,j,k)); faceDir.push_back(Opm::FaceDir::XPlus);
+                  cell1.push_back(grid.getGlobalIndex(i+1,j,k)); cell2.push_back(g); faceDir.push_back(Opm::FaceDir::XMinus);
+              }
+              if (k == 0) {
+                  cell1.push_back(g); cell2.push_back(grid.getGlobalIndex(i,j,k+1)); faceDir.push_back(Opm::FaceDir::ZPlus);
+              }
+          }
+      }
+  }
+
+  const auto multipliers = scanner.getRegionMultipliers(cell1, cell2, faceDir);
+  BOOST_REQUIRE_EQUAL(multipliers.size(), cell1.size());
+  for (std::size_t face = 0; face < cell1.size(); face++)
+      BOOST_CHECK_EQUAL(multipliers[face], scanner.getRegionMultiplier(cell1[face], cell2[face], faceDir[face]));
+
+  BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(0,0,1), grid.getGlobalIndex(1,0,1), Opm::FaceDir::XPlus ), 1.25);
+  BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(1,0,0), Opm::FaceDir::XMinus ), 0.75);
+  BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(0,0,0), grid.getGlobalIndex(0,0,1), Opm::FaceDir::ZPlus ), 0.0);
+
+  cell2.pop_back();
+  BOOST_CHECK_THROW( scanner.getRegionMultipliers(cell1, cell2, faceDir), std::invalid_argument );
+}
+
+
 
 
 static Opm::Deck createCopyMULTNUMDeck() {
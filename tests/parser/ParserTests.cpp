@@ -29,11 +29,13 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/P.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
 #include <opm/input/eclipse/Parser/ParserRecord.hpp>
@@ -41,7 +43,10 @@
 #include "src/opm/input/eclipse/Parser/raw/RawKeyword.hpp"
 #include "src/opm/input/eclipse/Parser/raw/RawRecord.hpp"
 
+#include "tests/WorkArea.cpp"
+
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 
 using namespace Opm;
@@ -680,6 +685,48 @@ BOOST_AUTO_TEST_CASE(Scan_All_WithDefaults) {
     BOOST_CHECK_EQUAL(25, deckIntItem.get< int >(21));
 }
 
+BOOST_AUTO_TEST_CASE(Scan_All_DataRecord) {
+    ParserItem itemDouble("ITEM", DOUBLE);
+    itemDouble.setSizeType(ParserItem::item_size::ALL);
+    itemDouble.setDefault(0.25);
+
+    const std::string input = "1 +2.5 3D2 2*4\n 'quoted token'\t 3* -1.5e-1 ";
+    auto rawRecord = RawRecord::dataRecord( input, KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK(!rawRecord.empty());
+    BOOST_CHECK_EQUAL(7U, rawRecord.size());
+    BOOST_CHECK_EQUAL(rawRecord.getItem(4), "'quoted token'");
+    BOOST_CHECK_THROW(rawRecord.getItem(7), std::out_of_range);
+
+    auto token = rawRecord.pop_front();
+    BOOST_CHECK_EQUAL(token, "1");
+    BOOST_CHECK_EQUAL(6U, rawRecord.size());
+    rawRecord.push_front(token, 1);
+
+    ParserItem itemString("STRINGS", STRING);
+    itemString.setSizeType(ParserItem::item_size::ALL);
+    UnitSystem unit_system;
+    auto stringRecord = RawRecord::dataRecord( "'quoted token'", KeywordLocation("KW", "File", 100) );
+    const auto deckStringItem = itemString.scan(stringRecord, unit_system, unit_system);
+    BOOST_CHECK_EQUAL("quoted token", deckStringItem.get< std::string >(0));
+
+    auto numeric = RawRecord::dataRecord( "1 +2.5 3D2 2*4 3* -1.5e-1", KeywordLocation("KW", "File", 100) );
+    const auto deckItem = itemDouble.scan(numeric, unit_system, unit_system);
+    BOOST_CHECK(numeric.empty());
+    BOOST_CHECK_EQUAL(9U, deckItem.data_size());
+    BOOST_CHECK_EQUAL(1.0,   deckItem.get< double >(0));
+    BOOST_CHECK_EQUAL(2.5,   deckItem.get< double >(1));
+    BOOST_CHECK_EQUAL(300.0, deckItem.get< double >(2));
+    BOOST_CHECK_EQUAL(4.0,   deckItem.get< double >(3));
+    BOOST_CHECK_EQUAL(4.0,   deckItem.get< double >(4));
+    BOOST_CHECK( deckItem.defaultApplied(5));
+    BOOST_CHECK( deckItem.defaultApplied(7));
+    BOOST_CHECK_EQUAL(0.25,  deckItem.get< double >(7));
+    BOOST_CHECK_EQUAL(-0.15, deckItem.get< double >(8));
+
+    auto invalid = RawRecord::dataRecord( "1 2 0*3", KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK_THROW(itemDouble.scan(invalid, unit_system, unit_system), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(Scan_SINGLE_CorrectIntSetInDeckItem) {
     ParserItem itemInt(std::string("ITEM2"), INT);
 
@@ -2509,3 +2556,111 @@ BOOST_AUTO_TEST_CASE(ParserKeywordSize) {
         BOOST_CHECK(!min_size.has_value());
     }
 }
+
+BOOST_AUTO_TEST_CASE(ParseThreads) {
+    const std::size_t nc = 20 * 20 * 40;
+
+    auto data_keyword = [nc](const std::string& name, double scale)
+    {
+        std::string kw = name + "\n";
+        for (std::size_t i = 0; i < nc; i++)
+            kw += std::to_string(scale * (i % 97)) + ((i % 10 == 9) ? "\n" : " ");
+
+        return kw + "/\n";
+    };
+
+    std::string deck_string = R"(
+RUNSPEC
+DIMENS
+  20 20 40 /
+FIELD
+GRID
+DX
+  16000*100 /
+)";
+    deck_string += data_keyword("DY", 1.5);
+    deck_string += data_keyword("DZ", 0.25);
+    deck_string += "TOPS\n 400*2000 /\n";
+    deck_string += data_keyword("PORO", 0.001);
+    deck_string += "ECHO\n";
+    deck_string += data_keyword("PERMX", 10.0);
+    deck_string += data_keyword("PERMY", 20.0);
+    deck_string += data_keyword("PERMZ", 1.0);
+
+    Parser parser;
+    BOOST_CHECK_EQUAL(parser.threads(), 1U);
+
+    const auto serial_deck = parser.parseString(deck_string);
+
+    parser.setThreads(4);
+    BOOST_CHECK_EQUAL(parser.threads(), 4U);
+
+    const auto parallel_deck = parser.parseString(deck_string);
+    BOOST_CHECK(parallel_deck == serial_deck);
+    BOOST_CHECK_EQUAL(parallel_deck.size(), serial_deck.size());
+    BOOST_CHECK_CLOSE(parallel_deck["PERMY"].back().getSIDoubleData()[96], serial_deck["PERMY"].back().getSIDoubleData()[96], 1e-12);
+
+    // Unit system can not be changed after dimensionfull keywords have been parsed.
+    BOOST_CHECK_THROW(parser.parseString(deck_string + "METRIC\n"), OpmInputError);
+
+    // Errors in deferred keywords are reported the same way as in a serial parse.
+    auto invalid_string = deck_string + data_keyword("NTG", 1.0);
+    invalid_string.replace(invalid_string.rfind("NTG") + 10, 1, "X");
+    BOOST_CHECK_THROW(parser.parseString(invalid_string), OpmInputError);
+
+    parser.setThreads(1);
+    BOOST_CHECK_THROW(parser.parseString(invalid_string), OpmInputError);
+
+    parser.setThreads(0);
+    BOOST_CHECK(parser.threads() >= 1);
+}
+
+BOOST_AUTO_TEST_CASE(DeckCacheTest) {
+    WorkArea work;
+    {
+        std::ofstream data("CASE.DATA");
+        data << "RUNSPEC\nDIMENS\n 10 10 1 /\nGRID\nINCLUDE\n 'grid.inc' /\n";
+    }
+    auto write_include = [](double poro) {
+        std::ofstream include("grid.inc");
+        include << "PORO\n 100*" << poro << " /\n";
+    };
+    write_include(0.25);
+
+    Parser parser;
+    const auto deck = parser.parseFile("CASE.DATA");
+
+    DeckCache cache("cache", 123);
+    BOOST_CHECK(!cache.load("CASE.DATA").has_value());
+    cache.store("CASE.DATA", deck);
+    BOOST_CHECK(std::filesystem::is_regular_file(cache.cacheFile("CASE.DATA")));
+
+    auto cached = cache.load("CASE.DATA");
+    BOOST_REQUIRE(cached.has_value());
+    BOOST_CHECK(cached.value() == deck);
+    BOOST_CHECK_EQUAL(cached->getDataFile(), deck.getDataFile());
+    BOOST_CHECK(cached->tree().includes("CASE.DATA", "grid.inc"));
+    BOOST_CHECK_EQUAL(cached->tree().files().size(), 2U);
+    BOOST_CHECK_EQUAL(cached->get<ParserKeywords::PORO>().back().getRecord(0).getItem(0).getSIDouble(99), 0.25);
+
+    BOOST_CHECK(!DeckCache("cache", 124).load("CASE.DATA").has_value());
+
+    write_include(0.30);
+    BOOST_CHECK(!cache.load("CASE.DATA").has_value());
+
+    cache.store("CASE.DATA", parser.parseFile("CASE.DATA"));
+    BOOST_CHECK(cache.load("CASE.DATA").has_value());
+    std::filesystem::resize_file(cache.cacheFile("CASE.DATA"), std::filesystem::file_size(cache.cacheFile("CASE.DATA")) / 2);
+    BOOST_CHECK(!cache.load("CASE.DATA").has_value());
+
+    parser.setDeckCache("parser_cache");
+    const auto deck1 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(std::distance(std::filesystem::directory_iterator("parser_cache"), std::filesystem::directory_iterator{}), 1);
+    const auto deck2 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(deck1 == deck2);
+    BOOST_CHECK_EQUAL(deck2.get<ParserKeywords::PORO>().back().getRecord(0).getItem(0).getSIDouble(0), 0.30);
+
+    write_include(0.35);
+    const auto deck3 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(deck3.get<ParserKeywords::PORO>().back().getRecord(0).getItem(0).getSIDouble(0), 0.35);
+}
@@ -100,3 +100,16 @@ BOOST_AUTO_TEST_CASE(IsFinished) {
 }
 
 
+
+BOOST_AUTO_TEST_CASE(DataRecordGetItem) {
+    std::string storage = "1 2 3";
+    const auto rec = RawRecord::dataRecord(std::string_view(storage), KeywordLocation("KW", "file", 100));
+
+    BOOST_CHECK_EQUAL(rec.getItem(2), "3");
+    try {
+        rec.getItem(7);
+        BOOST_FAIL("Expected std::out_of_range");
+    } catch (const std::out_of_range& e) {
+        BOOST_CHECK_EQUAL(std::string(e.what()), "Index 7 out of range in record");
+    }
+}
@@ -32,6 +32,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/common/utility/ActiveGridCells.hpp>
+#include <opm/common/utility/BinarySerializer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
@@ -44,6 +45,8 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/OilVaporizationProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
@@ -63,6 +66,8 @@
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
+#include <opm/input/eclipse/Utility/InputProfiler.hpp>
+#include <opm/json/JsonObject.hpp>
 
 #include <opm/input/eclipse/Schedule/Well/WellProductionProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellInjectionProperties.hpp>
@@ -4613,7 +4618,9 @@ END
         BOOST_CHECK( well.getStatus() ==  Well::Status::OPEN);
     }
 
+    const auto generation = sched.generation();
     sched.shut_well("P1", 0);
+    BOOST_CHECK(sched.generation() != generation);
 
 
     auto netbalan0 = sched[0].network_balance();
@@ -5071,3 +5078,69 @@ PERMZ
         BOOST_CHECK_THROW(sched_grid.get_cell(2,2,2), std::exception);
     }
 }
+
+BOOST_AUTO_TEST_CASE(WellPropertySharing) {
+    const auto schedule = make_schedule(createDeckWTEST());
+
+    const auto& well0 = schedule.getWell("BAN", 0);
+    const auto& well1 = schedule.getWell("BAN", 1);
+    BOOST_CHECK(!(well0 == well1));
+    BOOST_CHECK(well0.hasSameConnectionsPointers(well1));
+    BOOST_CHECK(&well0.units() == &well1.units());
+    BOOST_CHECK(&well0.getEconLimits() == &well1.getEconLimits());
+    BOOST_CHECK(&well0.getProductionProperties() != &well1.getProductionProperties());
+
+    const auto report = schedule.memoryReport();
+    BOOST_CHECK_EQUAL(report.step_bytes.size(), schedule.size());
+    BOOST_CHECK_EQUAL(report.members.at("ScheduleState").count, schedule.size());
+    BOOST_CHECK_EQUAL(report.members.at("Well::Connections").count, 9U);
+    BOOST_CHECK_EQUAL(report.members.at("Well::UnitSystem").count, 9U);
+
+    std::size_t member_bytes = 0;
+    for (const auto& [member, entry] : report.members) {
+        (void)member;
+        member_bytes += entry.bytes;
+    }
+    BOOST_CHECK_EQUAL(member_bytes, report.total_bytes());
+
+    // The versions of a well share their unchanged properties also after
+    // the Schedule has been serialized.
+    const auto buffer = BinarySerializer::pack(schedule);
+    Schedule copy(std::make_shared<Python>());
+    BinarySerializer::unpack(buffer, copy);
+    BOOST_CHECK(copy == schedule);
+
+    const auto& copy0 = copy.getWell("BAN", 0);
+    const auto& copy1 = copy.getWell("BAN", 1);
+    BOOST_CHECK(copy0.hasSameConnectionsPointers(copy1));
+    BOOST_CHECK(&copy0.units() == &copy1.units());
+    BOOST_CHECK(&copy0.getProductionProperties() != &copy1.getProductionProperties());
+    BOOST_CHECK_EQUAL(copy.memoryReport().total_bytes(), report.total_bytes());
+}
+
+BOOST_AUTO_TEST_CASE(InputProfile) {
+    InputProfiler::reset();
+    make_schedule(createDeckWTEST());
+    BOOST_CHECK(InputProfiler::json().find("WCONHIST") == std::string::npos);
+
+    InputProfiler::enable();
+    const auto schedule = make_schedule(createDeckWTEST());
+    InputProfiler::disable();
+
+    const auto json = InputProfiler::json();
+    BOOST_CHECK(json.find("\"Schedule\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"WCONHIST\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"schedule_memory\"") != std::string::npos);
+    const Json::JsonObject profile(json);
+    BOOST_CHECK_EQUAL(profile.get_item("schedule_memory").get_double("total_bytes"),
+                      static_cast<double>(schedule.memoryReport().total_bytes()));
+
+    // Keyword names are escaped in the JSON document.
+    InputProfiler::record("Schedule", "QUOTE\"\n", 1.0);
+    const Json::JsonObject escaped(InputProfiler::json());
+    const auto keywords = escaped.get_item("keywords").get_item("Schedule");
+    BOOST_CHECK_EQUAL(keywords.get_array_item(0).get_string("keyword"), "QUOTE\"\n");
+
+    InputProfiler::reset();
+    BOOST_CHECK(InputProfiler::json().find("WCONHIST") == std::string::npos);
+}
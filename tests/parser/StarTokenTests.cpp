@@ -19,6 +19,7 @@
 
 #define BOOST_TEST_MODULE ParserTests
 #include <stdexcept>
+#include <string_view>
 #include <boost/test/unit_test.hpp>
 
 #include "src/opm/input/eclipse/Parser/raw/StarToken.hpp"
@@ -125,3 +126,40 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+BOOST_AUTO_TEST_CASE( StarToken_views ) {
+    std::string_view countString, valueString;
+    BOOST_CHECK( Opm::isStarToken("12*3.5", countString, valueString) );
+    BOOST_CHECK_EQUAL( countString, "12" );
+    BOOST_CHECK_EQUAL( valueString, "3.5" );
+    BOOST_CHECK_EQUAL( 12U, Opm::starTokenCount("12*3.5", countString, valueString) );
+
+    BOOST_CHECK( Opm::isStarToken("*", countString, valueString) );
+    BOOST_CHECK_EQUAL( 1U, Opm::starTokenCount("*", countString, valueString) );
+
+    BOOST_CHECK( Opm::isStarToken("*7", countString, valueString) );
+    BOOST_CHECK_THROW( Opm::starTokenCount("*7", countString, valueString), std::invalid_argument );
+
+    BOOST_CHECK( Opm::isStarToken("00*", countString, valueString) );
+    BOOST_CHECK_THROW( Opm::starTokenCount("00*", countString, valueString), std::invalid_argument );
+
+    BOOST_CHECK( !Opm::isStarToken("1.5", countString, valueString) );
+}
+
+BOOST_AUTO_TEST_CASE( readValueToken_numeric_forms ) {
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "+-3" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "++3" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "+" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( "99999999999" ), std::invalid_argument );
+
+    BOOST_CHECK_EQUAL( 1.5, Opm::readValueToken<double>( "+1.5" ) );
+    BOOST_CHECK_EQUAL( 1000, Opm::readValueToken<double>( "1D3" ) );
+    BOOST_CHECK_EQUAL( 0.001, Opm::readValueToken<double>( "1d-3" ) );
+    BOOST_CHECK_EQUAL( 250, Opm::readValueToken<double>( "2.5E+2" ) );
+    BOOST_CHECK_EQUAL( 2, Opm::readValueToken<double>( "2." ) );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "+-1.5" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "1e" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "1D" ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( "" ), std::invalid_argument );
+}
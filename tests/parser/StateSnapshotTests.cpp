@@ -0,0 +1,196 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE StateSnapshotTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/StateSnapshot.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <tests/WorkArea.cpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace Opm;
+
+namespace {
+
+const std::string deck_string = R"(
+RUNSPEC
+DIMENS
+  3 3 2 /
+OIL
+WATER
+GAS
+DISGAS
+METRIC
+TABDIMS
+/
+WELLDIMS
+  2 10 2 2 /
+START
+  1 'JAN' 2020 /
+GRID
+INCLUDE
+  'GRID.INC' /
+PORO
+  18*0.25 /
+PERMX
+  18*100 /
+COPY
+  PERMX PERMY /
+  PERMX PERMZ /
+/
+MULTIPLY
+  PERMZ 0.1 /
+/
+PROPS
+REGIONS
+FIPNUM
+  9*1 9*2 /
+SUMMARY
+FOPR
+WBHP
+  'P' 'I' /
+RPR
+/
+SCHEDULE
+WELSPECS
+  'P' 'G' 1 1 1* 'OIL' /
+  'I' 'G' 3 3 1* 'WATER' /
+/
+COMPDAT
+  'P' 1 1 1 2 'OPEN' /
+  'I' 3 3 1 2 'OPEN' /
+/
+WCONPROD
+  'P' 'OPEN' 'ORAT' 100 /
+/
+WCONINJE
+  'I' 'WATER' 'OPEN' 'RATE' 200 /
+/
+TSTEP
+  10 /
+WCONPROD
+  'P' 'OPEN' 'ORAT' 200 /
+/
+TSTEP
+  10 /
+)";
+
+void write_deck() {
+    {
+        std::ofstream stream("CASE.DATA");
+        stream << deck_string;
+    }
+    {
+        std::ofstream stream("GRID.INC");
+        stream << "DX\n  18*100 /\nDY\n  18*100 /\nDZ\n  18*10 /\nTOPS\n  9*2000 /\n";
+    }
+}
+
+struct Input {
+    Input()
+        : deck(Parser{}.parseFile("CASE.DATA"))
+        , python(std::make_shared<Python>())
+        , es(deck)
+        , sched(deck, es, python)
+        , summary_config(deck, sched, es.fieldProps(), es.aquifer())
+    {}
+
+    Deck deck;
+    std::shared_ptr<Python> python;
+    EclipseState es;
+    Schedule sched;
+    SummaryConfig summary_config;
+};
+
+}
+
+BOOST_AUTO_TEST_CASE(SaveLoad) {
+    WorkArea work;
+    write_deck();
+
+    Input input;
+    StateSnapshot::save("CASE.SNAPSHOT", input.deck, input.es, input.sched, input.summary_config);
+
+    const auto snapshot = StateSnapshot::load("CASE.SNAPSHOT", input.python);
+    BOOST_REQUIRE(snapshot.has_value());
+
+    const auto& es = *snapshot->eclipse_state;
+    BOOST_CHECK(es.getTableManager() == input.es.getTableManager());
+    BOOST_CHECK(es.runspec() == input.es.runspec());
+    BOOST_CHECK(es.getInputGrid().equal(input.es.getInputGrid()));
+    BOOST_CHECK(es.fieldProps() == input.es.fieldProps());
+    BOOST_CHECK(es.fieldProps().get_double("PERMZ") == input.es.fieldProps().get_double("PERMZ"));
+    BOOST_CHECK(es.fieldProps().get_int("FIPNUM") == input.es.fieldProps().get_int("FIPNUM"));
+    BOOST_CHECK_EQUAL(es.getInputGrid().getCellVolume(4), input.es.getInputGrid().getCellVolume(4));
+
+    BOOST_CHECK(*snapshot->schedule == input.sched);
+    BOOST_CHECK(*snapshot->summary_config == input.summary_config);
+}
+
+BOOST_AUTO_TEST_CASE(RejectStale) {
+    WorkArea work;
+    write_deck();
+
+    {
+        Input input;
+        StateSnapshot::save("CASE.SNAPSHOT", input.deck, input.es, input.sched, input.summary_config);
+    }
+    BOOST_CHECK(!StateSnapshot::load("MISSING.SNAPSHOT", std::make_shared<Python>()).has_value());
+
+    // Modified include file
+    {
+        std::ofstream stream("GRID.INC", std::ios::app);
+        stream << "-- Comment\n";
+    }
+    BOOST_CHECK(!StateSnapshot::load("CASE.SNAPSHOT", std::make_shared<Python>()).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(RejectCorrupt) {
+    WorkArea work;
+    write_deck();
+
+    {
+        Input input;
+        StateSnapshot::save("CASE.SNAPSHOT", input.deck, input.es, input.sched, input.summary_config);
+    }
+    BOOST_REQUIRE(StateSnapshot::load("CASE.SNAPSHOT", std::make_shared<Python>()).has_value());
+
+    const auto size = std::filesystem::file_size("CASE.SNAPSHOT");
+    {
+        std::fstream stream("CASE.SNAPSHOT", std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(size - 100);
+        stream.put('X').put('Y').put('Z');
+    }
+    BOOST_CHECK(!StateSnapshot::load("CASE.SNAPSHOT", std::make_shared<Python>()).has_value());
+
+    std::filesystem::resize_file("CASE.SNAPSHOT", size / 2);
+    BOOST_CHECK(!StateSnapshot::load("CASE.SNAPSHOT", std::make_shared<Python>()).has_value());
+}
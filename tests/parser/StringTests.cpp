@@ -149,4 +149,36 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
 }
 
+BOOST_AUTO_TEST_CASE(shell_pattern_test) {
+    const ShellPattern literal("OP_1");
+    BOOST_CHECK( literal.literal() );
+    BOOST_CHECK( literal.match("OP_1") );
+    BOOST_CHECK( !literal.match("OP_12") );
+
+    const ShellPattern star("OP*1*");
+    BOOST_CHECK( !star.literal() );
+    BOOST_CHECK( star.match("OP1") );
+    BOOST_CHECK( star.match("OP_1_2") );
+    BOOST_CHECK( !star.match("XOP_1") );
+
+    BOOST_CHECK( shmatch("W[!AB]1", "WC1") );
+    BOOST_CHECK( !shmatch("W[!AB]1", "WA1") );
+    BOOST_CHECK( shmatch("W[^AB]1", "WC1") );
+    BOOST_CHECK( shmatch("W[]X]", "W]") );
+    BOOST_CHECK( shmatch("W\\*", "W*") );
+    BOOST_CHECK( !shmatch("W\\*", "WX") );
+    BOOST_CHECK( shmatch("W(1)+", "W(1)+") );
+    BOOST_CHECK( shmatch("W[1", "W[1") );
+    BOOST_CHECK( shmatch("*", "") );
+    BOOST_CHECK( !shmatch("?", "") );
+    BOOST_CHECK( shmatch("*A*A*", "AXA") );
+    BOOST_CHECK( !shmatch("*A*A*", "XAX") );
+
+    const std::vector<std::string> names = {"OP_1", "OP_2", "INJ_1", "OP_10"};
+    BOOST_CHECK( match_all("OP_?", names) == std::vector<std::size_t>({0, 1}) );
+    BOOST_CHECK( match_all("*_1*", names) == std::vector<std::size_t>({0, 2, 3}) );
+    BOOST_CHECK( match_all("INJ_1", names) == std::vector<std::size_t>({2}) );
+    BOOST_CHECK( match_all("PROD*", names).empty() );
+}
+
 
@@ -74,3 +74,56 @@ MULTZ
     transMult.applyMULT(fp.get_global_double("MULTZ"), Opm::FaceDir::ZPlus);
     BOOST_CHECK_EQUAL( transMult.getMultiplier(0,0,0 , Opm::FaceDir::ZPlus) , 4.0 );
 }
+
+
+BOOST_AUTO_TEST_CASE(ApplyMultipliers) {
+    const std::string deck_string = R"(
+RUNSPEC
+DIMENS
+ 3 1 1 /
+GRID
+MULTX
+  2 3 4 /
+MULTX-
+  5 6 7 /
+MULTNUM
+  1 1 2 /
+MULTREGT
+  1 2 0.5 X ALL M /
+/
+)";
+
+    Opm::Parser parser;
+    Opm::Deck deck = parser.parseString(deck_string);
+    Opm::TableManager tables(deck);
+    Opm::EclipseGrid grid(3,1,1);
+    Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tables);
+    Opm::TransMult transMult(grid, deck, fp);
+    transMult.applyMULT(fp.get_global_double("MULTX"), Opm::FaceDir::XPlus);
+    transMult.applyMULT(fp.get_global_double("MULTX-"), Opm::FaceDir::XMinus);
+
+    std::vector<std::size_t> cell1 = {0, 1, 2};
+    std::vector<std::size_t> cell2 = {1, 2, 1};
+    std::vector<Opm::FaceDir::DirEnum> faceDir = {Opm::FaceDir::XPlus, Opm::FaceDir::XPlus, Opm::FaceDir::XMinus};
+    std::vector<double> trans = {1, 1, 10};
+    transMult.applyMultipliers(cell1, cell2, faceDir, trans);
+
+    BOOST_CHECK_EQUAL( trans[0], 2.0 * 6.0 );
+    BOOST_CHECK_EQUAL( trans[1], 3.0 * 7.0 * 0.5 );
+    BOOST_CHECK_EQUAL( trans[2], 10 * 7.0 * 3.0 * 0.5 );
+
+    for (std::size_t face = 0; face < cell1.size(); face++) {
+        const auto opposite = faceDir[face] == Opm::FaceDir::XPlus ? Opm::FaceDir::XMinus : Opm::FaceDir::XPlus;
+        double expected = transMult.getMultiplier(cell1[face], faceDir[face])
+                        * transMult.getMultiplier(cell2[face], opposite)
+                        * transMult.getRegionMultiplier(cell1[face], cell2[face], faceDir[face]);
+        BOOST_CHECK_EQUAL( trans[face], (face == 2 ? 10 : 1) * expected );
+    }
+
+    trans.pop_back();
+    BOOST_CHECK_THROW( transMult.applyMultipliers(cell1, cell2, faceDir, trans), std::invalid_argument );
+
+    trans.push_back(1);
+    cell2[2] = 3;
+    BOOST_CHECK_THROW( transMult.applyMultipliers(cell1, cell2, faceDir, trans), std::invalid_argument );
+}
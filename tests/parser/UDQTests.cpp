@@ -19,6 +19,7 @@ Copyright 2018 Statoil ASA.
 
 #include <limits>
 #include <stdexcept>
+#include <utility>
 
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/input/eclipse/Utility/Typetools.hpp>
@@ -293,6 +294,32 @@ BOOST_AUTO_TEST_CASE(UDQWellSetTest) {
 }
 
 
+BOOST_AUTO_TEST_CASE(UDQSetElementAccess) {
+    std::vector<std::string> wells = {"P1", "P2", "I1"};
+    UDQSet ws1 = UDQSet::wells("WU1", wells);
+    UDQSet ws2 = UDQSet::wells("WU2", wells, 2.0);
+
+    ws1.assign("P1", 1.0);
+    ws1.assign("I1", 3.0);
+    ws2.assign(2, 0.0);
+
+    const auto res = ws1 / ws2;
+    BOOST_CHECK(res.defined(0));
+    BOOST_CHECK(!res.defined(1));
+    BOOST_CHECK(!res.defined(2));
+    BOOST_CHECK_EQUAL(res.get(0), 0.5);
+    BOOST_CHECK_EQUAL(res.wgname(2), "I1");
+    BOOST_CHECK_THROW(res.get(1), std::invalid_argument);
+    BOOST_CHECK_EQUAL(res.defined_size(), 1U);
+
+    std::vector<std::string> names;
+    for (const auto& value : res)
+        names.push_back(value.wgname());
+    BOOST_CHECK(names == wells);
+    BOOST_CHECK(res.wgnames() == wells);
+}
+
+
 BOOST_AUTO_TEST_CASE(UDQ_GROUP_TEST) {
     std::vector<std::string> groups = {"G1", "G2", "G3", "G4"};
     UDQSet gs = UDQSet::groups("NAME", groups);
@@ -2449,6 +2476,134 @@ UDQ
     BOOST_CHECK_EQUAL(fu_var3, 4);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_PROGRAM) {
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    KeywordLocation location;
+    SummaryState st(TimeService::now());
+    UDQState udq_state(udqp.undefinedValue());
+    UDQContext context(udqft, WellMatcher(NameOrder({"P1", "P2", "I1", "I2"})), st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 4);
+    st.update_well_var("P2", "WOPR", 3);
+    st.update_well_var("I1", "WOPR", 2);
+    st.update_well_var("P1", "WWPR", 1);
+    st.update_well_var("P2", "WWPR", 0);
+    st.update_well_var("I1", "WWPR", 1);
+    st.update_well_var("I2", "WWPR", 7);
+    st.update_group_var("G1", "GOPR", 10);
+    st.update_group_var("G2", "GOPR", 20);
+    st.update("FOPR", 100);
+
+    const std::vector<std::pair<std::string, std::vector<std::string>>> expressions = {
+        {"WUVAR", {"WOPR", "+", "WWPR"}},
+        {"WUVAR", {"-", "WOPR", "/", "(", "WOPR", "+", "WWPR", ")"}},
+        {"WUVAR", {"WOPR", "'P*'", "*", "2"}},
+        {"WUVAR", {"NINT", "(", "WWPR", "/", "2", ")", "-", "FOPR"}},
+        {"WUVAR", {"WOPR", ">", "WWPR"}},
+        {"FUVAR", {"SUM", "(", "WOPR", ")", "+", "MAX", "(", "WWPR", ")", "*", "FOPR"}},
+        {"FUVAR", {"WOPR", "'P2'", "-", "GOPR", "'G2'"}},
+        {"GUVAR", {"GOPR", "/", "FOPR"}},
+    };
+
+    for (const auto& [keyword, tokens] : expressions) {
+        UDQDefine def(udqp, keyword, 0, location, tokens);
+        for (int iter = 0; iter < 2; iter++) {
+            const auto compiled = def.eval(context);
+            const auto tree = def.eval_tree(context);
+
+            BOOST_CHECK_EQUAL(compiled.size(), tree.size());
+            BOOST_CHECK(compiled.var_type() == tree.var_type());
+            for (std::size_t index = 0; index < tree.size(); index++) {
+                BOOST_CHECK_EQUAL(compiled.wgname(index), tree.wgname(index));
+                BOOST_CHECK_EQUAL(compiled.defined(index), tree.defined(index));
+                if (tree.defined(index))
+                    BOOST_CHECK_EQUAL(compiled.get(index), tree.get(index));
+            }
+
+            // The handles of the program must follow a change of the
+            // SummaryState layout.
+            st.update_well_var("I2", "WOPR", 5);
+            st.update_group_var("G1", "GOPR", 30);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_INCREMENTAL) {
+    std::string deck_string = R"(
+SCHEDULE
+
+WELSPECS
+     'P1'         'OP'   20   51  3.92       'OIL'  3*  NO /
+     'P2'         'OP'   20   51  3.92       'OIL'  3*  NO /
+     'P3'         'OP'   20   51  3.92       'OIL'  3*  NO /
+/
+
+UDQ
+  DEFINE WUOPR2 WOPR * 2 /
+  DEFINE WUDIFF WUOPR2 - WUNEXT /
+  DEFINE WUNEXT WOPR /
+  DEFINE GUGOPR GOPR / 2 /
+  DEFINE FUTOT SUM(WUOPR2) + FOPR /
+  DEFINE FUNEXT FUTOT + 1 /
+  UPDATE FUNEXT NEXT /
+/
+
+TSTEP
+1 /
+
+UDQ
+  UPDATE FUNEXT NEXT /
+  DEFINE FUTOT SUM(WUOPR2) - FOPR /
+/
+
+TSTEP
+1 /
+)";
+
+    const auto schedule = make_schedule(deck_string);
+    SummaryState st(TimeService::now());
+    UDQState udq_state(0);
+    SummaryState st_ref(TimeService::now());
+    UDQState udq_state_ref(0);
+
+    const auto update = [&st, &st_ref](const std::string& well, const std::string& var, double value) {
+        st.update_well_var(well, var, value);
+        st_ref.update_well_var(well, var, value);
+    };
+
+    st.update("FOPR", 100);
+    st_ref.update("FOPR", 100);
+    for (const auto& group : {"G1", "G2"}) {
+        st.update_group_var(group, "GOPR", 10);
+        st_ref.update_group_var(group, "GOPR", 10);
+    }
+
+    const std::vector<std::pair<std::size_t, double>> steps = {{0, 1}, {0, 1}, {0, 2}, {1, 2}, {1, 2}, {1, 3}, {2, 4}};
+    for (const auto& [report_step, p2_rate] : steps) {
+        update("P1", "WOPR", 1);
+        update("P2", "WOPR", p2_rate);
+        if (p2_rate > 2)
+            update("P3", "WOPR", 3);
+
+        const auto& udq = schedule.getUDQConfig(report_step);
+        udq.eval(report_step, schedule.wellMatcher(report_step), st, udq_state);
+
+        // The reference state is evaluated without the records of the
+        // previous evaluation.
+        udq_state_ref.deserialize(udq_state_ref.serialize());
+        udq.eval(report_step, schedule.wellMatcher(report_step), st_ref, udq_state_ref);
+
+        BOOST_CHECK(udq_state == udq_state_ref);
+        BOOST_CHECK(st == st_ref);
+    }
+
+    // WUDIFF is evaluated with the value of WUNEXT from the previous
+    // evaluation.
+    BOOST_CHECK_EQUAL(st.get_well_var("P2", "WUDIFF"), 2*4 - 3);
+    BOOST_CHECK_EQUAL(st.get("FUTOT"), 2*(1 + 4 + 3) - 100);
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_MINUS_PAREN) {
     std::string deck_string = R"(
 SCHEDULE
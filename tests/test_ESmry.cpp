@@ -395,6 +395,39 @@ BOOST_AUTO_TEST_CASE(TestESmry_5) {
         BOOST_CHECK_CLOSE(wopr_prod2[n], qoil_p2[n], 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(TestESmry_TimeRange) {
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    ESmry smry2("SPE1CASE1.SMSPEC");
+    smry2.loadData();
+
+    const auto& time = smry2.get("TIME");
+    const auto& wgpr = smry2.get("WGPR:PROD");
+
+    std::vector<float> time_range, wgpr_range;
+    for (std::size_t n = 0; n < time.size(); n++) {
+        if ((time[n] >= 365) && (time[n] <= 730)) {
+            time_range.push_back(time[n]);
+            wgpr_range.push_back(wgpr[n]);
+        }
+    }
+
+    BOOST_CHECK(!time_range.empty());
+
+    // Range read from disk and slice of a loaded vector.
+    BOOST_CHECK(smry1.get("WGPR:PROD", 365, 730) == wgpr_range);
+    BOOST_CHECK(smry2.get("WGPR:PROD", 365, 730) == wgpr_range);
+    BOOST_CHECK(smry1.get("WGPR:PROD", 1e6, 2e6).empty());
+
+    const auto history = smry1.history({"WGPR:PROD", "FGOR"}, 365, 730);
+    BOOST_CHECK_EQUAL(history.size(), time_range.size());
+    BOOST_CHECK(history.get("WGPR:PROD") == wgpr_range);
+    BOOST_CHECK(history.get("FGOR") == smry2.get("FGOR", 365, 730));
+    BOOST_CHECK_EQUAL(history.time(0), time_range.front());
+
+    BOOST_CHECK_THROW(smry1.get("NO_SUCH_KEY", 0, 1), std::invalid_argument);
+}
+
 
 
 namespace fs = std::filesystem;
@@ -29,6 +29,7 @@
 #include <cmath>
 #include <numeric>
 
+#include <opm/io/eclipse/ByteSwap.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include "WorkArea.cpp"
@@ -129,6 +130,58 @@ BOOST_AUTO_TEST_CASE(TestEclFile_X231) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestByteSwap) {
+
+    // odd number of elements to exercise the scalar tail of the vectorized kernels
+    std::vector<int> ivect(1003);
+    std::iota(ivect.begin(), ivect.end(), -500);
+
+    std::vector<float> fvect(1003);
+    std::vector<double> dvect(1003);
+
+    for (size_t n = 0; n < ivect.size(); n++) {
+        fvect[n] = 1.25f * ivect[n];
+        dvect[n] = -3.5 * ivect[n];
+    }
+
+    const auto kernels = availableByteSwapKernels();
+
+    BOOST_CHECK(kernels.front() == ByteSwapKernel::Scalar);
+    BOOST_CHECK(kernels.back() == activeByteSwapKernel());
+
+    for (const auto& kernel : kernels) {
+        BOOST_TEST_MESSAGE("Checking byte swap kernel: " << byteSwapKernelName(kernel));
+
+        std::vector<int> iswap(ivect.size());
+        byteSwap32(ivect.data(), iswap.data(), ivect.size(), kernel);
+
+        for (size_t n = 0; n < ivect.size(); n++)
+            BOOST_CHECK_EQUAL(iswap[n], flipEndianInt(ivect[n]));
+
+        std::vector<double> dswap(dvect.size());
+        byteSwap64(dvect.data(), dswap.data(), dvect.size(), kernel);
+
+        for (size_t n = 0; n < dvect.size(); n++)
+            BOOST_CHECK_EQUAL(flipEndianDouble(dswap[n]), dvect[n]);
+
+        // in place conversion, twice gives the original values back
+        auto fswap = fvect;
+        byteSwap32(fswap.data(), fswap.data(), fswap.size(), kernel);
+
+        for (size_t n = 0; n < fvect.size(); n++)
+            BOOST_CHECK_EQUAL(flipEndianFloat(fswap[n]), fvect[n]);
+
+        byteSwap32(fswap.data(), fswap.data(), fswap.size(), kernel);
+        BOOST_CHECK(fswap == fvect);
+    }
+
+    auto dswap = dvect;
+    byteSwap(dswap.data(), dswap.size());
+    byteSwap(dswap.data(), dswap.size());
+    BOOST_CHECK(dswap == dvect);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_BINARY) {
 
     std::string testFile="ECLFILE.INIT";
@@ -195,6 +248,69 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped) {
+
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(!file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    // arrays loaded from the memory mapped file should be identical to the arrays
+    // loaded through the file stream, this includes the multi record arrays
+
+    BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+    BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+    BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+    BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+
+    // zero copy views, element wise and bulk decoding
+
+    auto porv = file1.get<float>("PORV");
+    auto porvView = file2.getView<float>("PORV");
+
+    BOOST_CHECK_EQUAL(porvView.size(), 3146U);
+
+    for (size_t n = 0; n < porv.size(); n++)
+        BOOST_CHECK_EQUAL(porvView[n], porv[n]);
+
+    BOOST_CHECK(porvView.decode() == porv);
+    BOOST_CHECK_THROW(porvView.at(3146), std::out_of_range);
+
+    auto xcon = file1.get<double>("XCON");
+    auto xconView = file2.getView<double>(3);
+
+    BOOST_CHECK(xconView.decode() == xcon);
+    BOOST_CHECK_EQUAL(xconView[1739], xcon[1739]);
+
+    // a view can be requested also if the file was not opened in memory mapped mode
+
+    auto iconView = file1.getView<int>("ICON");
+    BOOST_CHECK(iconView.decode() == file1.get<int>("ICON"));
+    BOOST_CHECK(!file1.memoryMapped());
+
+    BOOST_CHECK_THROW(file2.getView<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<float>("XPORV"), std::invalid_argument);
+
+    // the view keeps the mapping alive
+
+    EclArrayView<double> view;
+    {
+        EclFile file3(testFile, EclFile::MemoryMapped{true});
+        view = file3.getView<double>("XCON");
+    }
+
+    BOOST_CHECK(view.decode() == xcon);
+
+    EclFile file4("ECLFILE.FINIT", EclFile::MemoryMapped{true});
+    BOOST_CHECK(!file4.memoryMapped());
+    BOOST_CHECK_THROW(file4.getView<int>("ICON"), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 
     std::string testFile1="ECLFILE.INIT";
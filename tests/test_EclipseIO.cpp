@@ -281,7 +281,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         "'PROD' 'G' 3 3 1000 'OIL' /\n"
         "/\n";
 
-    auto write_and_check = [&]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&]( int first = 1, int last = 5, bool async_output = false ) {
         auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         auto& eclGrid = es.getInputGrid();
@@ -292,6 +292,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        eclWriter.setAsyncOutput( async_output );
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -339,9 +340,16 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
                                      first_step - start_time,
                                      std::move(restart_value));
 
+            eclWriter.flush();
             checkRestartFile( i );
         }
 
+        if (async_output) {
+            // Modifying the Schedule is allowed when no output is pending.
+            schedule.shut_well("PROD", schedule.size() - 1);
+            BOOST_CHECK_NO_THROW( eclWriter.flush() );
+        }
+
         checkInitFile( deck , eGridProps);
         checkEgridFile( eclGrid );
 
@@ -391,4 +399,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
      * the file
      */
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
+
+    /* the asynchronous output mode must produce the same restart file */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true ) );
 }
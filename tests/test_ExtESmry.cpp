@@ -20,8 +20,13 @@
 
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/ExtESmry.hpp>
+#include <opm/io/eclipse/ExtSmryOutput.hpp>
 #include <opm/common/utility/FileSystem.hpp>
 
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
 #define BOOST_TEST_MODULE Test EclIO
 #include <boost/test/unit_test.hpp>
 
@@ -375,3 +380,91 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
 
 }
 
+
+BOOST_AUTO_TEST_CASE(TestExtSmryOutput_Incremental) {
+
+    const std::string deck_string = R"(
+RUNSPEC
+DIMENS
+ 2 2 1 /
+START
+ 1 'JAN' 2020 /
+GRID
+DX
+ 4*100 /
+DY
+ 4*100 /
+DZ
+ 4*10 /
+TOPS
+ 4*2000 /
+PORO
+ 4*0.3 /
+)";
+
+    WorkArea work;
+
+    Opm::EclipseState es(Opm::Parser{}.parseString(deck_string));
+    es.getIOConfig().setOutputDir(".");
+    es.getIOConfig().setBaseName("INCREMENTAL");
+
+    const std::vector<std::string> keys  { "TIME", "FOPT", "BPR:4" };
+    const std::vector<std::string> units { "DAYS", "SM3", "BARSA" };
+
+    Opm::EclIO::ExtSmryOutput smry_output(keys, units, es, 0);
+
+    auto ts_data = [](int step)
+    {
+        return std::vector<float> { 10.0f * step, 100.0f + step, 200.0f - step };
+    };
+
+    // Steps spread over several chunks, the last one with more than
+    // one record (1000 elements) for each vector.
+
+    const int nstep = 1500;
+    int flushed = 0;
+
+    for (int step = 0; step < nstep; step++) {
+        smry_output.write(ts_data(step), (step % 10) == 0);
+
+        if ((step == 0) || (step == 63) || (step == 64) || (step == 1023) || (step == nstep - 1)) {
+
+            // Buffered steps are not visible until flush(), or until the
+            // buffer is flushed to grow the file by another chunk; the file
+            // is consistent after each flush. The flushed blocks span
+            // several chunks and the first record boundary.
+
+            if (flushed > 0) {
+                ExtESmry esmry("INCREMENTAL.ESMRY");
+                BOOST_CHECK(esmry.numberOfTimeSteps() >= static_cast<std::size_t>(flushed));
+                BOOST_CHECK(esmry.numberOfTimeSteps() <= static_cast<std::size_t>(step));
+            }
+
+            smry_output.flush();
+            flushed = step + 1;
+
+            ExtESmry esmry("INCREMENTAL.ESMRY");
+            BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), static_cast<std::size_t>(step + 1));
+            BOOST_CHECK_EQUAL(esmry.numberOfVectors(), keys.size());
+            BOOST_CHECK(esmry.hasKey("BPR:2,2,1"));
+
+            const auto& time = esmry.get("TIME");
+            const auto& fopt = esmry.get("FOPT");
+            const auto& bpr  = esmry.get("BPR:2,2,1");
+
+            BOOST_REQUIRE_EQUAL(time.size(), static_cast<std::size_t>(step + 1));
+            BOOST_REQUIRE_EQUAL(fopt.size(), static_cast<std::size_t>(step + 1));
+            BOOST_REQUIRE_EQUAL(bpr.size(), static_cast<std::size_t>(step + 1));
+
+            for (int n = 0; n <= step; n++) {
+                const auto ref = ts_data(n);
+                BOOST_CHECK_EQUAL(time[n], ref[0]);
+                BOOST_CHECK_EQUAL(fopt[n], ref[1]);
+                BOOST_CHECK_EQUAL(bpr[n], ref[2]);
+            }
+
+            BOOST_CHECK_EQUAL(esmry.get_unit("FOPT"), "SM3");
+            BOOST_CHECK_EQUAL(esmry.get_at_rstep("TIME").size(), static_cast<std::size_t>(step / 10 + 1));
+        }
+    }
+}
@@ -33,6 +33,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <opm/output/data/Groups.hpp>
 #include <opm/output/data/GuideRateValue.hpp>
 #include <opm/output/data/Wells.hpp>
@@ -44,6 +48,7 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
@@ -1379,6 +1384,30 @@ BOOST_AUTO_TEST_CASE(DATE) {
     BOOST_CHECK_EQUAL(year[3], 2007);
 }
 
+BOOST_AUTO_TEST_CASE(add_timestep_elapsed_not_increasing) {
+    setup cfg( "test_summary_elapsed_not_increasing" );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+    writer.eval( st, 1, 2 * day, cfg.wells , cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 1, false);
+
+    // A different SummaryState with an earlier elapsed time is still
+    // buffered and written in the order of the ministeps.
+    SummaryState st_early(TimeService::now());
+    writer.eval( st_early, 2, 1 * day, cfg.wells , cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_NO_THROW( writer.add_timestep( st_early, 2, false) );
+    writer.write();
+
+    auto res = readsum( cfg.name );
+    const auto* resp = res.get();
+
+    BOOST_CHECK_EQUAL( resp->numberOfTimeSteps(), 2U );
+    BOOST_CHECK_CLOSE( 2.0, ecl_sum_get_field_var( resp, 0, "TIME" ), 1e-5 );
+    BOOST_CHECK_CLOSE( 1.0, ecl_sum_get_field_var( resp, 1, "TIME" ), 1e-5 );
+    BOOST_CHECK_CLOSE( 10.0 + 20.0, ecl_sum_get_field_var( resp, 1, "FWPR" ), 1e-5 );
+}
+
 BOOST_AUTO_TEST_CASE(field_keywords) {
     setup cfg( "test_summary_field" );
 
@@ -2258,6 +2287,69 @@ BOOST_AUTO_TEST_CASE(efficiency_factor) {
 
 
 
+BOOST_AUTO_TEST_CASE(efficiency_factor_apply_keywords) {
+    setup cfg( "test_efficiency_factor_apply_keywords", "SUMMARY_EFF_FAC.DATA", false );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+
+    // The summary is evaluated at report step last + 1, i.e. with the
+    // wells of the final schedule step last.
+    const auto last = static_cast<int>(cfg.schedule.size()) - 1;
+    writer.eval( st, last + 1, 1 * day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 10.1, st.get_well_var("W_1", "WOPT"), 1e-5 );
+
+    // Keywords applied at the final report step do not rerun the schedule
+    // section, the summary must still see the new efficiency factor.
+    const auto deck = Parser{}.parseString("SCHEDULE\nWEFAC\n 'W_1' 0.5 /\n/\n");
+    auto wefac = deck["WEFAC"].back();
+    std::vector<DeckKeyword*> keywords { &wefac };
+
+    const auto generation = cfg.schedule.generation();
+    cfg.schedule.applyKeywords(keywords, last);
+    BOOST_CHECK(cfg.schedule.generation() != generation);
+
+    writer.eval( st, last + 1, 2 * day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 10.1 + 0.5 * 10.1, st.get_well_var("W_1", "WOPT"), 1e-5 );
+}
+
+BOOST_AUTO_TEST_CASE(parallel_evaluation) {
+    setup cfg( "test_summary_parallel" );
+
+    // The evaluators are only computed in parallel for a summary
+    // configuration with at least 256 vectors.
+    BOOST_REQUIRE( cfg.config.size() >= 256 );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    const auto start = TimeService::now();
+#ifdef _OPENMP
+    const auto max_threads = omp_get_max_threads();
+#endif
+    auto evaluate = [&](const int num_threads) {
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads);
+#else
+        (void) num_threads;
+#endif
+        SummaryState st(start);
+        writer.eval( st, 0, 0 * day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+        writer.eval( st, 1, 1 * day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+        writer.eval( st, 2, 2 * day, cfg.wells, cfg.grp_nwrk, {}, {}, {}, {});
+        return st;
+    };
+
+    const auto serial = evaluate(1);
+    const auto parallel = evaluate(4);
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    BOOST_CHECK( serial == parallel );
+    BOOST_CHECK_EQUAL( serial.size(), parallel.size() );
+    for (const auto& [key, value] : serial)
+        BOOST_CHECK_EQUAL( value, parallel.get(key) );
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     Opm::SummaryState st(TimeService::now());
     st.update("WWCT:OP_2", 100);
@@ -3853,6 +3945,105 @@ BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(Summary_State)
 
+BOOST_AUTO_TEST_CASE(SummaryState_Handle) {
+    SummaryState st(TimeService::now());
+
+    auto wopr = st.well_var_handle("OP1", "WOPR");
+    auto wopt = st.well_var_handle("OP1", "WOPT");
+    auto gopr = st.group_var_handle("G1", "GOPR");
+    auto copr = st.conn_var_handle("OP1", "COPR", 10);
+    auto fopr = st.handle("FOPR");
+    BOOST_CHECK(wopr.valid());
+    BOOST_CHECK(!SummaryState::Handle{}.valid());
+
+    // Registering a handle does not add a value
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK(!st.has_well_var("OP1", "WOPR"));
+    BOOST_CHECK(!st.has("WOPR:OP1"));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+    BOOST_CHECK_EQUAL(st.size(), 0U);
+    BOOST_CHECK_THROW(st.get(wopr), std::out_of_range);
+    BOOST_CHECK_EQUAL(st.get(wopr, -1), -1);
+
+    st.update(wopr, 100);
+    st.update(wopr, 100);
+    st.update(wopt, 100);
+    st.update(wopt, 100);
+    st.update(gopr, 50);
+    st.update(copr, 10);
+    st.update(fopr, 150);
+    BOOST_CHECK_EQUAL(st.get(wopr), 100);
+    BOOST_CHECK_EQUAL(st.get(wopt), 200);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 100);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 200);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPR"), 50);
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP1", "COPR", 10), 10);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 150);
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+    BOOST_CHECK_EQUAL(st.groups().size(), 1U);
+
+    // The string based and handle based access share the same storage
+    st.update_well_var("OP1", "WOPT", 50);
+    BOOST_CHECK_EQUAL(st.get(wopt), 250);
+    BOOST_CHECK(st.well_var_handle("OP1", "WOPT").valid());
+    BOOST_CHECK_EQUAL(st.get(st.well_var_handle("OP1", "WOPT")), 250);
+
+    // Handles remain valid across erase() and deserialize()
+    BOOST_CHECK(st.erase_well_var("OP1", "WOPR"));
+    BOOST_CHECK(!st.has(wopr));
+    st.update(wopr, 75);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 75);
+
+    auto copy = st;
+    st.update(wopr, 80);
+    BOOST_CHECK_EQUAL(copy.get(wopr), 75);
+    copy.deserialize(st.serialize());
+    BOOST_CHECK_EQUAL(copy.get(wopr), 80);
+    BOOST_CHECK(copy == st);
+
+    std::size_t num_values = 0;
+    for (const auto& [key, value] : st) {
+        BOOST_CHECK_EQUAL(st.get(key), value);
+        num_values++;
+    }
+    BOOST_CHECK_EQUAL(num_values, st.size());
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_Version) {
+    SummaryState st(TimeService::now());
+    BOOST_CHECK_EQUAL(st.version("WOPR"), 0U);
+
+    st.update_well_var("OP1", "WOPR", 100);
+    const auto wopr_version = st.version("WOPR");
+    const auto names_version = st.names_version();
+    BOOST_CHECK(wopr_version != 0);
+
+    // Updating with an unchanged value does not change the version
+    st.update_well_var("OP1", "WOPR", 100);
+    st.update("FOPR", 10);
+    BOOST_CHECK_EQUAL(st.version("WOPR"), wopr_version);
+    BOOST_CHECK(st.version("FOPR") != 0);
+
+    st.update_well_var("OP2", "WOPR", 50);
+    BOOST_CHECK(st.version("WOPR") != wopr_version);
+    BOOST_CHECK(st.names_version() != names_version);
+
+    const auto fopr_version = st.version("FOPR");
+    st.update("FOPR", 20);
+    BOOST_CHECK(st.version("FOPR") != fopr_version);
+
+    const auto wopr_version2 = st.version("WOPR");
+    const auto names_version2 = st.names_version();
+    BOOST_CHECK(st.erase_well_var("OP2", "WOPR"));
+    BOOST_CHECK(st.version("WOPR") != wopr_version2);
+    BOOST_CHECK(st.names_version() != names_version2);
+
+    const auto wopr_version3 = st.version("WOPR");
+    auto copy = st;
+    copy.deserialize(st.serialize());
+    BOOST_CHECK(copy.version("WOPR") != wopr_version3);
+}
+
 BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     SummaryState st(TimeService::now());
     st.update("FOPR", 100);
@@ -0,0 +1,103 @@
+/*
+  Copyright 2022 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE SummaryHistory
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/SummaryHistory.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using Opm::EclIO::SummaryHistory;
+
+namespace {
+    SummaryHistory make_history(std::size_t nStep, std::size_t chunkSize) {
+        SummaryHistory history({"TIME", "FOPR", "WBHP:P1"}, chunkSize);
+
+        for (std::size_t step = 0; step < nStep; step++) {
+            const auto t = static_cast<float>(step);
+            history.append(t, {t, 10 * t, 100 * t});
+        }
+
+        return history;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AppendAndGet) {
+    const auto history = make_history(10, 4);
+
+    BOOST_CHECK_EQUAL(history.size(), 10U);
+    BOOST_CHECK(history.hasKey("FOPR"));
+    BOOST_CHECK(!history.hasKey("FWPR"));
+    BOOST_CHECK_THROW(history.get("FWPR"), std::invalid_argument);
+
+    const auto fopr = history.get("FOPR");
+    BOOST_REQUIRE_EQUAL(fopr.size(), 10U);
+    for (std::size_t step = 0; step < fopr.size(); step++)
+        BOOST_CHECK_EQUAL(fopr[step], 10.0f * step);
+
+    std::vector<float> row;
+    history.row(5, row);
+    BOOST_CHECK(row == std::vector<float>({5, 50, 500}));
+    BOOST_CHECK_EQUAL(history.time(9), 9.0);
+    BOOST_CHECK_THROW(history.row(10, row), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(TimeRange) {
+    const auto history = make_history(10, 4);
+
+    // The range spans three blocks.
+    BOOST_CHECK(history.get("WBHP:P1", 2.5, 8) == std::vector<float>({300, 400, 500, 600, 700, 800}));
+    BOOST_CHECK(history.times(2.5, 8) == std::vector<double>({3, 4, 5, 6, 7, 8}));
+    BOOST_CHECK(history.get("FOPR", 0, 0) == std::vector<float>({0}));
+    BOOST_CHECK(history.get("FOPR", 20, 30).empty());
+    BOOST_CHECK(history.get("FOPR", 5, 4).empty());
+
+    const auto [first, last] = history.range(-1, 100);
+    BOOST_CHECK_EQUAL(first, 0U);
+    BOOST_CHECK_EQUAL(last, 10U);
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedTimes) {
+    SummaryHistory history({"FOPR"}, 2);
+    history.append(1, {1});
+    history.append(2, {2});
+    history.append(2, {3});
+    history.append(3, {4});
+
+    BOOST_CHECK(history.get("FOPR", 2, 2) == std::vector<float>({2, 3}));
+    BOOST_CHECK_THROW(history.append(2.5, {5}), std::invalid_argument);
+    BOOST_CHECK_THROW(history.append(4, {5, 6}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Clear) {
+    auto history = make_history(10, 4);
+    history.clear();
+
+    BOOST_CHECK(history.empty());
+    BOOST_CHECK(history.get("FOPR").empty());
+    BOOST_CHECK(history.times().empty());
+
+    history.append(1, {1, 2, 3});
+    BOOST_CHECK_EQUAL(history.size(), 1U);
+    BOOST_CHECK(history.get("WBHP:P1") == std::vector<float>({3}));
+}